@@ -133,6 +133,7 @@ void tlib_set_number_of_mpu_regions(uint32_t value)
         tlib_abortf("Failed to set number of unified MPU regions to %u, maximal supported value is %u", value, MAX_MPU_REGIONS);
     }
     cpu->number_of_mpu_regions = value;
+    arm_invalidate_region_maps(cpu);
 }
 
 EXC_VOID_1(tlib_set_number_of_mpu_regions, uint32_t, value)
@@ -440,6 +441,7 @@ void tlib_set_mpu_region_base_address(uint32_t value)
         tlib_set_mpu_region_number(value & 0xF);
     }
     cpu->cp15.c6_base_address[cpu->cp15.c6_region_number] = value & 0xFFFFFFE0;
+    arm_invalidate_region_maps(cpu);
 #if DEBUG
     tlib_printf(LOG_LEVEL_DEBUG, "MPU: Set base address 0x%x, for region %lld", value & 0xFFFFFFE0, cpu->cp15.c6_region_number);
 #endif
@@ -454,6 +456,7 @@ void tlib_set_mpu_region_size_and_enable(uint32_t value)
     uint32_t index = cpu->cp15.c6_region_number;
     cpu->cp15.c6_size_and_enable[index] = value & MPU_SIZE_AND_ENABLE_FIELD_MASK;
     cpu->cp15.c6_subregion_disable[index] = (value & MPU_SUBREGION_DISABLE_FIELD_MASK) >> MPU_SUBREGION_DISABLE_FIELD_OFFSET;
+    arm_invalidate_region_maps(cpu);
     cpu->cp15.c6_access_control[index] = value >> 16;
 #if DEBUG
     tlib_printf(LOG_LEVEL_DEBUG, "MPU: Set access control 0x%x, permissions 0x%x, size 0x%x, enable 0x%x, for region %lld",
@@ -504,6 +507,7 @@ void tlib_set_number_of_sau_regions(uint32_t value)
         tlib_printf(LOG_LEVEL_WARNING, "Setting SAU regions to %u, but TrustZone is not enabled", value);
     }
     cpu->number_of_sau_regions = value;
+    arm_invalidate_region_maps(cpu);
     tlb_flush(cpu, 1, false);
 }
 
@@ -560,6 +564,7 @@ void tlib_set_sau_region_base_address(uint32_t value)
         return;
     }
     cpu->sau.rbar[region] = value;
+    arm_invalidate_region_maps(cpu);
     tlb_flush(cpu, 1, false);
 }
 
@@ -577,6 +582,7 @@ void tlib_set_sau_region_limit_address(uint32_t value)
         return;
     }
     cpu->sau.rlar[region] = value;
+    arm_invalidate_region_maps(cpu);
     tlb_flush(cpu, 1, false);
 }
 
@@ -638,6 +644,7 @@ void tlib_set_number_of_idau_regions(uint32_t value)
         tlib_abortf("Failed to set number of IDAU regions to %u, maximal supported value is %u", value, MAX_IDAU_REGIONS);
     }
     cpu->number_of_idau_regions = value;
+    arm_invalidate_region_maps(cpu);
     tlb_flush(cpu, 1, false);
 }
 
@@ -699,6 +706,7 @@ void tlib_set_idau_region_base_address_register(uint32_t index, uint32_t value)
         return;
     }
     cpu->idau.rbar[index] = value;
+    arm_invalidate_region_maps(cpu);
     tlb_flush(cpu, 1, false);
 }
 
@@ -723,6 +731,7 @@ void tlib_set_idau_region_limit_address_register(uint32_t index, uint32_t value)
         return;
     }
     cpu->idau.rlar[index] = value;
+    arm_invalidate_region_maps(cpu);
     tlb_flush(cpu, 1, false);
 }
 
@@ -905,6 +914,7 @@ void tlib_set_pmsav8_rbar(uint32_t value, uint32_t region_offset, bool secure)
         index = (index << 2) + region_offset;
     }
     cpu->pmsav8[secure].rbar[index] = value;
+    arm_invalidate_region_maps(cpu);
 }
 EXC_VOID_3(tlib_set_pmsav8_rbar, uint32_t, value, uint32_t, region_offset, bool, secure)
 
@@ -929,6 +939,7 @@ void tlib_set_pmsav8_rlar(uint32_t value, uint32_t region_offset, bool secure)
         }
     }
     cpu->pmsav8[secure].rlar[index] = value;
+    arm_invalidate_region_maps(cpu);
 }
 EXC_VOID_3(tlib_set_pmsav8_rlar, uint32_t, value, uint32_t, region_offset, bool, secure)
 
@@ -25,6 +25,7 @@
 #include "tightly_coupled_memory.h"
 #include "ttable.h"
 #include "pmu.h"
+#include "mpu_map.h"
 #include "cpu_common.h"
 
 #include "softfloat-2.h"
@@ -502,12 +503,24 @@ typedef struct CPUState {
     /* Fields after CPU_COMMON are preserved on reset but not serialized as opposed to the ones before CPU_COMMON. */
 
     TTable *cp_regs;
+
+    /* Flattened MPU/SAU/IDAU regions, rebuilt lazily after the region registers change */
+    struct {
+        mpu_map_t pmsav7;
+#ifdef TARGET_PROTO_ARM_M
+        mpu_map_t pmsav8[M_REG_NUM_BANKS];
+        mpu_map_t sau;
+        mpu_map_t idau;
+#endif
+    } region_maps;
 } CPUState;
 
 void switch_mode(CPUState *, int);
 
 int cpu_handle_mmu_fault(CPUState *env, target_ulong address, int rw, int mmu_idx, int no_page_fault, target_phys_addr_t *paddr);
 
+void arm_invalidate_region_maps(CPUState *env);
+
 #define PRIMASK_EN 1
 
 #define CPSR_M        (0x1f)
@@ -561,6 +561,12 @@ void cpu_on_leaving_reset_state(CPUState *env)
     configuration_signals_apply(env);
 }
 
+void cpu_after_load(CPUState *env)
+{
+    //  Region maps are derived from the MPU, SAU and IDAU registers which were just overwritten.
+    arm_invalidate_region_maps(env);
+}
+
 void cpu_reset(CPUState *env)
 {
     uint32_t id = env->cp15.c0_cpuid;
@@ -571,6 +577,7 @@ void cpu_reset(CPUState *env)
     uint32_t number_of_sau_regions = env->number_of_sau_regions;
 #endif
     memset(env, 0, RESET_OFFSET);
+    arm_invalidate_region_maps(env);
     if(id) {
         cpu_reset_model_id(env, id);
     }
@@ -2714,62 +2721,46 @@ static int pmsav7_check_default_mapping(uint32_t address, int *prot, int access_
     return (*prot & (1 << access_type)) ? MPU_SUCCESS : MPU_PERMISSION_FAULT;
 }
 
-static int get_mpu_subregion_number(uint32_t region_base_address, uint32_t region_size, uint32_t address)
+void arm_invalidate_region_maps(CPUState *env)
 {
-    /* Subregion size is 2^(region_size - 3) */
-    uint32_t subregion_size = 1 << (region_size - 3);
-    return (address - region_base_address) / subregion_size;
+    mpu_map_invalidate(&env->region_maps.pmsav7);
+#ifdef TARGET_PROTO_ARM_M
+    for(int i = 0; i < M_REG_NUM_BANKS; i++) {
+        mpu_map_invalidate(&env->region_maps.pmsav8[i]);
+    }
+    mpu_map_invalidate(&env->region_maps.sau);
+    mpu_map_invalidate(&env->region_maps.idau);
+#endif
 }
 
-static bool page_with_address_is_fully_covered_by_consistent_mpu_subregions(uint32_t subregion_disable_mask,
-                                                                            uint32_t region_base_address, uint32_t region_size,
-                                                                            uint32_t address)
+static void free_region_maps(CPUState *env)
 {
-    int i, first_subregion_number, last_subregion_number;
-    uint32_t first_subregion_state;
-    uint32_t page_start = address & TARGET_PAGE_MASK;
-    uint32_t page_size = TARGET_PAGE_SIZE;
-
-    if(region_base_address > page_start || region_base_address + region_size < page_start + page_size) {
-        //  No need to check particular subregions as a page is not contained within the whole region
-        return false;
-    }
-
-    first_subregion_number = get_mpu_subregion_number(region_base_address, region_size, page_start);
-    last_subregion_number = get_mpu_subregion_number(region_base_address, region_size, page_start + page_size - 1);
-
-    if(first_subregion_number == last_subregion_number) {
-        return true;
-    }
-
-    first_subregion_state = !(subregion_disable_mask & (1 << first_subregion_number));
-    for(i = first_subregion_number + 1; i <= last_subregion_number; i++) {
-        if(first_subregion_state != !(subregion_disable_mask & (1 << i))) {
-            //  There are mixed disabled and enabled subregions covering a single page
-            return false;
-        }
+    mpu_map_free(&env->region_maps.pmsav7);
+#ifdef TARGET_PROTO_ARM_M
+    for(int i = 0; i < M_REG_NUM_BANKS; i++) {
+        mpu_map_free(&env->region_maps.pmsav8[i]);
     }
-    return true;
+    mpu_map_free(&env->region_maps.sau);
+    mpu_map_free(&env->region_maps.idau);
+#endif
 }
 
-static int get_phys_addr_mpu(CPUState *env, uint32_t address, int access_type, int is_user, uint32_t *phys_ptr, int *prot,
-                             target_ulong *page_size)
+/* Every enabled subregion of a region becomes a separate span; regions smaller than 256 bytes have no subregions. */
+static const mpu_map_t *pmsav7_get_region_map(CPUState *env)
 {
-    int n;
+    mpu_map_t *map = &env->region_maps.pmsav7;
+    mpu_map_span_t spans[MAX_MPU_REGIONS * 8];
+    uint32_t spans_count = 0;
     uint32_t base;
     uint32_t size;
-    uint32_t mask;
-    uint32_t perms;
-    bool page_contains_mpu_region = false;
-
-    *phys_ptr = address;
-    *prot = 0;
+    uint64_t mask;
+    int n, i;
 
-#if DEBUG
-    tlib_printf(LOG_LEVEL_DEBUG, "MPU: Trying to access address 0x%X", address);
-#endif
+    if(likely(map->valid)) {
+        return map;
+    }
 
-    for(n = env->number_of_mpu_regions - 1; n >= 0; n--) {
+    for(n = 0; n < env->number_of_mpu_regions; n++) {
         if(!(env->cp15.c6_size_and_enable[n] & MPU_REGION_ENABLED_BIT)) {
             continue;
         }
@@ -2794,58 +2785,63 @@ static int get_phys_addr_mpu(CPUState *env, uint32_t address, int access_type, i
             base = base & (~mask);
         }
 
-        if((address & TARGET_PAGE_MASK) == (base & TARGET_PAGE_MASK)) {
-            page_contains_mpu_region = true;
+        /* Subregions exist only if region size is equal to or bigger than 256 bytes (region size = 2^size) */
+        if(size < 8) {
+            spans[spans_count++] = (mpu_map_span_t) { .start = base, .end = base + mask, .region = n };
+            continue;
         }
-
-        /* Check if the region is enabled */
-        if(address >= base && address <= base + mask) {
-            /* Check subregions, only if region size is equal to or bigger than 256 bytes (region size = 2^size) */
-            if(size >= 8) {
-                if(!page_with_address_is_fully_covered_by_consistent_mpu_subregions(env->cp15.c6_subregion_disable[n], base,
-                                                                                    1 << size, address)) {
-                    /* MPU subregions with the same state (enabled/disabled) don't cover the whole page.
-                     * Setting page size != TARGET_PAGE_SIZE effectively makes the tlb page entry one-shot:
-                     * Thanks to this every access to this page will be verified against MPU.
-                     */
-                    *page_size = 0;
-                }
-                if(env->cp15.c6_subregion_disable[n] & (1 << get_mpu_subregion_number(base, size, address))) {
-                    /* Subregion containing this address is disabled, try to match this address to a different region. */
-                    continue;
-                }
-            } else {
-                /* The page is not fully covered by a single MPU region */
-                *page_size = 0;
+        /* Subregion size is 2^(size - 3) */
+        uint64_t subregion_size = 1ull << (size - 3);
+        for(i = 0; i < 8; i++) {
+            if(env->cp15.c6_subregion_disable[n] & (1 << i)) {
+                /* Addresses in a disabled subregion can only be matched by a different region */
+                continue;
             }
-
-            break;
+            spans[spans_count++] = (mpu_map_span_t) {
+                .start = base + i * subregion_size,
+                .end = base + (i + 1) * subregion_size - 1,
+                .region = n,
+            };
         }
     }
 
-    if(n < 0) {  //  background fault
-        int background_result;
+    mpu_map_build(map, spans, spans_count, MPU_MAP_HIGHEST_REGION_WINS);
+    return map;
+}
+
+static int get_phys_addr_mpu(CPUState *env, uint32_t address, int access_type, int is_user, uint32_t *phys_ptr, int *prot,
+                             target_ulong *page_size)
+{
+    int n;
+    uint32_t perms;
+    bool page_is_uniform;
+
+    *phys_ptr = address;
+    *prot = 0;
+
+#if DEBUG
+    tlib_printf(LOG_LEVEL_DEBUG, "MPU: Trying to access address 0x%X", address);
+#endif
+
+    n = mpu_map_lookup(pmsav7_get_region_map(env), address, TARGET_PAGE_SIZE, &page_is_uniform);
+    if(!page_is_uniform) {
+        /* Other regions or subregions with a different state (enabled/disabled) cover a part of the page.
+         * Setting page size != TARGET_PAGE_SIZE effectively makes the tlb page entry one-shot:
+         * Thanks to this every access to this page will be verified against MPU.
+         */
+        *page_size = 0;
+    }
+
+    if(n == MPU_MAP_NO_REGION) {  //  background fault
         if(arm_feature(env, ARM_FEATURE_PMSA)) {
             if(is_user || !(env->cp15.c1_sys & (1 << 17 /* BR, Background Region */))) {
-                background_result = MPU_BACKGROUND_FAULT;
-            } else {
-                background_result = pmsav7_check_default_mapping(address, prot, access_type);
+                return MPU_BACKGROUND_FAULT;
             }
+            return pmsav7_check_default_mapping(address, prot, access_type);
         } else if(!is_user) {
-            background_result = cortexm_check_default_mapping(address, prot, access_type);
-        } else {
-            background_result = TRANSLATE_FAIL;
-        }
-
-        if(background_result == TRANSLATE_SUCCESS && page_contains_mpu_region) {
-            /* Background pages cannot be stored in tlb if those pages contain any MPU regions
-             * as access checks will not be performed for pages that are present in TLB.
-             * Setting page size != TARGET_PAGE_SIZE effectively makes the tlb page entry one-shot:
-             * Thanks to this every access to this page will be verified against MPU.
-             */
-            *page_size = 0;
+            return cortexm_check_default_mapping(address, prot, access_type);
         }
-        return background_result;
+        return TRANSLATE_FAIL;
     }
 
     perms = (env->cp15.c6_access_control[n] & MPU_PERMISSION_FIELD_MASK) >> 8;
@@ -2947,53 +2943,57 @@ static inline void update__applies_to_whole_page(uint32_t address, uint32_t regi
     }
 }
 
-/* `applies_to_whole_page` can be passed NULL in which case the function won't be checking if the
- * returned permissions are valid for the whole page. The same applies if it's value is false from
- * the beginning in which case it will always stay false.
- */
-static inline bool pmsav8_get_region(CPUState *env, uint32_t address, bool secure, int *region_index, bool *multiple_regions,
-                                     bool *applies_to_whole_page)
+static const mpu_map_t *pmsav8_get_region_map(CPUState *env, bool secure)
 {
-    int n;
-    bool hit = false;
-    *multiple_regions = false;
-    *region_index = PMSA_MPU_REGION_INVALID;
+    mpu_map_t *map = &env->region_maps.pmsav8[secure];
+    mpu_map_span_t spans[MAX_MPU_REGIONS];
+    uint32_t spans_count = 0;
 
-    for(n = env->number_of_mpu_regions - 1; n >= 0; n--) {
+    if(likely(map->valid)) {
+        return map;
+    }
+
+    for(int n = 0; n < env->number_of_mpu_regions; n++) {
         if(!(env->pmsav8[secure].rlar[n] & 0x1)) {
             /* Region disabled */
             continue;
         }
+        spans[spans_count++] = (mpu_map_span_t) {
+            .start = pmsav8_idau_sau_get_region_base(env->pmsav8[secure].rbar[n]),
+            .end = pmsav8_idau_sau_get_region_limit(env->pmsav8[secure].rlar[n]),
+            .region = n,
+        };
+    }
 
-        uint32_t base = pmsav8_idau_sau_get_region_base(env->pmsav8[secure].rbar[n]);
-        uint32_t limit = pmsav8_idau_sau_get_region_limit(env->pmsav8[secure].rlar[n]);
-
-        update__applies_to_whole_page(address, base, limit, applies_to_whole_page);
-
-        if(address < base || address > limit) {
-            /* Addr not in this region */
-            continue;
-        }
+    mpu_map_build(map, spans, spans_count, MPU_MAP_OVERLAP_IS_MULTIPLE);
+    return map;
+}
 
-        /* region matched */
-        if(hit) {
-            /* multiple regions always return a failure
-             * in this case region_index _must not_ be used
-             */
-            *multiple_regions = true;
-            *region_index = PMSA_MPU_REGION_INVALID;
+/* `applies_to_whole_page` can be passed NULL in which case the function won't be checking if the
+ * returned permissions are valid for the whole page. The same applies if it's value is false from
+ * the beginning in which case it will always stay false.
+ */
+static inline bool pmsav8_get_region(CPUState *env, uint32_t address, bool secure, int *region_index, bool *multiple_regions,
+                                     bool *applies_to_whole_page)
+{
+    bool covers_page;
+    int32_t region = mpu_map_lookup(pmsav8_get_region_map(env, secure), address, TARGET_PAGE_SIZE, &covers_page);
 
-            /* Returning after finding the second region is safe even if `applies_to_whole_page` is
-             * still true because `multiple_regions` will fail translation so permissions won't be
-             * added to TLB anyway.
-             */
-            return false;
-        }
+    if(applies_to_whole_page != NULL && !covers_page) {
+        *applies_to_whole_page = false;
+    }
 
-        hit = true;
-        *region_index = n;
+    /* multiple regions always return a failure
+     * in this case region_index _must not_ be used
+     */
+    *multiple_regions = region == MPU_MAP_MULTIPLE_REGIONS;
+    if(region < 0) {
+        *region_index = PMSA_MPU_REGION_INVALID;
+        return false;
     }
-    return hit;
+
+    *region_index = region;
+    return true;
 }
 
 //  Always check return value first as `found_index` is only valid on success.
@@ -3067,74 +3067,71 @@ static inline bool pmsav8_is_exempt_from_attribution(uint32_t address, int acces
     return false;
 }
 
-/* `applies_to_whole_page` can be passed NULL in which case the function won't be checking if the
- * returned attribution is the same for the whole page. The same applies if it's value is false from
- * the beginning in which case it will always stay false.
- */
-static inline bool pmsav8_idau_sau_try_get_region(uint32_t address, uint32_t *rbars, uint32_t *rlars, uint32_t regions_count,
-                                                  int *region_index, enum security_attribution *attribution,
-                                                  bool *applies_to_whole_page)
+static const mpu_map_t *pmsav8_idau_sau_get_region_map(mpu_map_t *map, uint32_t *rbars, uint32_t *rlars, uint32_t regions_count)
 {
-    int n;
-    bool hit = false;
-    *region_index = -1;
-    *attribution = SA_SECURE;
+    mpu_map_span_t spans[MAX(MAX_SAU_REGIONS, MAX_IDAU_REGIONS)];
+    uint32_t spans_count = 0;
+
+    if(likely(map->valid)) {
+        return map;
+    }
 
-    for(n = 0; n < regions_count; n++) {
+    for(int n = 0; n < regions_count; n++) {
         if(!(rlars[n] & IDAU_SAU_RLAR_ENABLE)) {
             /* Region disabled */
             continue;
         }
+        spans[spans_count++] = (mpu_map_span_t) {
+            .start = pmsav8_idau_sau_get_region_base(rbars[n]),
+            .end = pmsav8_idau_sau_get_region_limit(rlars[n]),
+            .region = n,
+        };
+    }
 
-        uint32_t base = pmsav8_idau_sau_get_region_base(rbars[n]);
-        uint32_t limit = pmsav8_idau_sau_get_region_limit(rlars[n]);
-        bool nsc = rlars[n] & IDAU_SAU_RLAR_NSC;
+    /* Note that an address has to match exactly one region. SAU region isn't valid otherwise
+     * and we follow the same rules for IDAU.
+     */
+    mpu_map_build(map, spans, spans_count, MPU_MAP_OVERLAP_IS_MULTIPLE);
+    return map;
+}
 
-        update__applies_to_whole_page(address, base, limit, applies_to_whole_page);
+/* `applies_to_whole_page` can be passed NULL in which case the function won't be checking if the
+ * returned attribution is the same for the whole page. The same applies if it's value is false from
+ * the beginning in which case it will always stay false.
+ */
+static inline bool pmsav8_idau_sau_try_get_region(const mpu_map_t *map, uint32_t address, uint32_t *rlars, int *region_index,
+                                                  enum security_attribution *attribution, bool *applies_to_whole_page)
+{
+    bool covers_page;
+    int32_t region = mpu_map_lookup(map, address, TARGET_PAGE_SIZE, &covers_page);
 
-        if(address < base || address > limit) {
-            /* Addr not in this region */
-            continue;
-        }
+    if(applies_to_whole_page != NULL && !covers_page) {
+        *applies_to_whole_page = false;
+    }
 
-        /* Another region matched?
-         *
-         * Note that we don't break the loop after finding the first matching region as we need to
-         * make sure it's the only matching region. SAU region isn't valid otherwise and we follow
-         * the same rules for IDAU.
-         */
-        if(hit) {
-            /* An address that matches multiple SAU regions is marked as Secure and
-             * not Not-secure callable regardless of the attributes specified by the
-             * regions that matched the address; ARMv8-M Manual: Rule WGDK.
-             */
-            *attribution = SA_SECURE;
+    *region_index = -1;
 
-            /* Returning after finding the second region is safe even if `applies_to_whole_page` is
-             * still true and there is yet another region only partially covering the page.
-             *
-             * The only possible option for that is that both matched regions cover the whole page.
-             * In that case a potential third region only partially covering the page won't really
-             * matter as the two matched regions covering the whole page will make the the result
-             * the same for every access of this page.
-             */
-            return false;
-        }
+    /* An address that matches multiple SAU regions is marked as Secure and
+     * not Not-secure callable regardless of the attributes specified by the
+     * regions that matched the address; ARMv8-M Manual: Rule WGDK.
+     */
+    if(region < 0) {
+        *attribution = SA_SECURE;
+        return false;
+    }
 
-        hit = true;
-        *region_index = n;
+    *region_index = region;
 
-        /* Memory is marked as Secure by default. However, if the address matches a region with
-         * SAU_REGIONn.ENABLE set to 1 and SAU_REGIONn.NSC set to 0, then memory is marked as
-         * Non-secure; ARMv8-M Manual: Rule MPJC.
-         *
-         * This is somewhat contrary to the SAU_RLAR.NSC bit description which states that 0 means
-         * "Region is marked with the Secure attribute and is not Non-secure callable." but the
-         * behavior is confirmed by pseudocode for SecurityCheck in the ARMv8-M Manual.
-         */
-        *attribution = nsc ? SA_SECURE_NSC : SA_NONSECURE;
-    }
-    return hit;
+    /* Memory is marked as Secure by default. However, if the address matches a region with
+     * SAU_REGIONn.ENABLE set to 1 and SAU_REGIONn.NSC set to 0, then memory is marked as
+     * Non-secure; ARMv8-M Manual: Rule MPJC.
+     *
+     * This is somewhat contrary to the SAU_RLAR.NSC bit description which states that 0 means
+     * "Region is marked with the Secure attribute and is not Non-secure callable." but the
+     * behavior is confirmed by pseudocode for SecurityCheck in the ARMv8-M Manual.
+     */
+    *attribution = (rlars[region] & IDAU_SAU_RLAR_NSC) ? SA_SECURE_NSC : SA_NONSECURE;
+    return true;
 }
 
 /* The return value is true if SAU is enabled and a single region was matched. */
@@ -3150,8 +3147,9 @@ static inline bool pmsav8_sau_try_get_region(CPUState *env, uint32_t address, in
         return false;
     }
 
-    return pmsav8_idau_sau_try_get_region(address, env->sau.rbar, env->sau.rlar, env->number_of_sau_regions, region_index,
-                                          attribution, applies_to_whole_page);
+    const mpu_map_t *map =
+        pmsav8_idau_sau_get_region_map(&env->region_maps.sau, env->sau.rbar, env->sau.rlar, env->number_of_sau_regions);
+    return pmsav8_idau_sau_try_get_region(map, address, env->sau.rlar, region_index, attribution, applies_to_whole_page);
 }
 
 /* The return value is true if a single IDAU region was matched. */
@@ -3161,8 +3159,9 @@ static inline bool pmsav8_idau_try_get_region(CPUState *env, uint32_t address, i
     //  The function should only be called if IDAU is enabled cause IDAU disabled is indistinguishable from no hit
     tlib_assert(env->idau.enabled);
 
-    return pmsav8_idau_sau_try_get_region(address, env->idau.rbar, env->idau.rlar, env->number_of_idau_regions, region_index,
-                                          attribution, applies_to_whole_page);
+    const mpu_map_t *map =
+        pmsav8_idau_sau_get_region_map(&env->region_maps.idau, env->idau.rbar, env->idau.rlar, env->number_of_idau_regions);
+    return pmsav8_idau_sau_try_get_region(map, address, env->idau.rlar, region_index, attribution, applies_to_whole_page);
 }
 
 /* `applies_to_whole_page` can be passed NULL in which case the function won't be checking if the
@@ -5169,6 +5168,7 @@ void HELPER(v8m_vlldm)(CPUState *env, uint32_t address)
 void tlib_arch_dispose()
 {
     ttable_remove(cpu->cp_regs);
+    free_region_maps(cpu);
 }
 
 void HELPER(set_system_event)(void)
@@ -15,12 +15,12 @@ DEF_HELPER_1(clz, i32, i32)
 DEF_HELPER_1(sxtb16, i32, i32)
 DEF_HELPER_1(uxtb16, i32, i32)
 
-DEF_HELPER_2(add_setq, i32, i32, i32)
-DEF_HELPER_2(add_saturate, i32, i32, i32)
-DEF_HELPER_2(sub_saturate, i32, i32, i32)
-DEF_HELPER_2(add_usaturate, i32, i32, i32)
-DEF_HELPER_2(sub_usaturate, i32, i32, i32)
-DEF_HELPER_1(double_saturate, i32, s32)
+DEF_HELPER_FLAGS_2(add_setq, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(add_saturate, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(sub_saturate, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(add_usaturate, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(sub_usaturate, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_1(double_saturate, TCG_CALL_NO_RWG, i32, s32)
 DEF_HELPER_3(sdiv, s32, env, s32, s32)
 DEF_HELPER_3(udiv, i32, env, i32, i32)
 DEF_HELPER_1(rbit, i32, i32)
@@ -51,10 +51,10 @@ PAS_OP(uq)
 PAS_OP(uh)
 #undef PAS_OP
 
-DEF_HELPER_2(ssat, i32, i32, i32)
-DEF_HELPER_2(usat, i32, i32, i32)
-DEF_HELPER_2(ssat16, i32, i32, i32)
-DEF_HELPER_2(usat16, i32, i32, i32)
+DEF_HELPER_FLAGS_2(ssat, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(usat, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(ssat16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(usat16, TCG_CALL_NO_RWG, i32, i32, i32)
 
 DEF_HELPER_2(usad8, i32, i32, i32)
 
@@ -107,83 +107,83 @@ DEF_HELPER_2(vfp_set_vpr_p0, void, env, i32)
 DEF_HELPER_1(is_fpu_context_active, i32, env)
 #endif
 
-DEF_HELPER_3(vfp_adds, f32, f32, f32, ptr)
-DEF_HELPER_3(vfp_addd, f64, f64, f64, ptr)
-DEF_HELPER_3(vfp_subs, f32, f32, f32, ptr)
-DEF_HELPER_3(vfp_subd, f64, f64, f64, ptr)
-DEF_HELPER_3(vfp_muls, f32, f32, f32, ptr)
-DEF_HELPER_3(vfp_muld, f64, f64, f64, ptr)
-DEF_HELPER_3(vfp_divs, f32, f32, f32, ptr)
-DEF_HELPER_3(vfp_divd, f64, f64, f64, ptr)
-DEF_HELPER_1(vfp_negs, f32, f32)
-DEF_HELPER_1(vfp_negd, f64, f64)
-DEF_HELPER_1(vfp_abss, f32, f32)
-DEF_HELPER_1(vfp_absd, f64, f64)
-DEF_HELPER_2(vfp_sqrts, f32, f32, env)
-DEF_HELPER_2(vfp_sqrtd, f64, f64, env)
+DEF_HELPER_FLAGS_3(vfp_adds, TCG_CALL_NO_RWG, f32, f32, f32, ptr)
+DEF_HELPER_FLAGS_3(vfp_addd, TCG_CALL_NO_RWG, f64, f64, f64, ptr)
+DEF_HELPER_FLAGS_3(vfp_subs, TCG_CALL_NO_RWG, f32, f32, f32, ptr)
+DEF_HELPER_FLAGS_3(vfp_subd, TCG_CALL_NO_RWG, f64, f64, f64, ptr)
+DEF_HELPER_FLAGS_3(vfp_muls, TCG_CALL_NO_RWG, f32, f32, f32, ptr)
+DEF_HELPER_FLAGS_3(vfp_muld, TCG_CALL_NO_RWG, f64, f64, f64, ptr)
+DEF_HELPER_FLAGS_3(vfp_divs, TCG_CALL_NO_RWG, f32, f32, f32, ptr)
+DEF_HELPER_FLAGS_3(vfp_divd, TCG_CALL_NO_RWG, f64, f64, f64, ptr)
+DEF_HELPER_FLAGS_1(vfp_negs, TCG_CALL_NO_RWG, f32, f32)
+DEF_HELPER_FLAGS_1(vfp_negd, TCG_CALL_NO_RWG, f64, f64)
+DEF_HELPER_FLAGS_1(vfp_abss, TCG_CALL_NO_RWG, f32, f32)
+DEF_HELPER_FLAGS_1(vfp_absd, TCG_CALL_NO_RWG, f64, f64)
+DEF_HELPER_FLAGS_2(vfp_sqrts, TCG_CALL_NO_RWG, f32, f32, env)
+DEF_HELPER_FLAGS_2(vfp_sqrtd, TCG_CALL_NO_RWG, f64, f64, env)
 DEF_HELPER_3(vfp_cmps, void, f32, f32, env)
 DEF_HELPER_3(vfp_cmpd, void, f64, f64, env)
 DEF_HELPER_3(vfp_cmpes, void, f32, f32, env)
 DEF_HELPER_3(vfp_cmped, void, f64, f64, env)
-DEF_HELPER_3(vfp_maxnums, f32, f32, f32, ptr)
-DEF_HELPER_3(vfp_maxnumd, f64, f64, f64, ptr)
-DEF_HELPER_3(vfp_minnums, f32, f32, f32, ptr)
-DEF_HELPER_3(vfp_minnumd, f64, f64, f64, ptr)
-
-DEF_HELPER_2(vfp_fcvtds, f64, f32, env)
-DEF_HELPER_2(vfp_fcvtsd, f32, f64, env)
-
-DEF_HELPER_2(vfp_uitos, f32, i32, ptr)
-DEF_HELPER_2(vfp_uitod, f64, i32, ptr)
-DEF_HELPER_2(vfp_sitos, f32, i32, ptr)
-DEF_HELPER_2(vfp_sitod, f64, i32, ptr)
-
-DEF_HELPER_2(vfp_touis, i32, f32, ptr)
-DEF_HELPER_2(vfp_touid, i32, f64, ptr)
-DEF_HELPER_2(vfp_touizs, i32, f32, ptr)
-DEF_HELPER_2(vfp_touizd, i32, f64, ptr)
-DEF_HELPER_2(vfp_tosis, i32, f32, ptr)
-DEF_HELPER_2(vfp_tosid, i32, f64, ptr)
-DEF_HELPER_2(vfp_tosizs, i32, f32, ptr)
-DEF_HELPER_2(vfp_tosizd, i32, f64, ptr)
-
-DEF_HELPER_3(vfp_toshs, i32, f32, i32, ptr)
-DEF_HELPER_3(vfp_tosls, i32, f32, i32, ptr)
-DEF_HELPER_3(vfp_touhs, i32, f32, i32, ptr)
-DEF_HELPER_3(vfp_touls, i32, f32, i32, ptr)
-DEF_HELPER_3(vfp_toshd, i64, f64, i32, ptr)
-DEF_HELPER_3(vfp_tosld, i64, f64, i32, ptr)
-DEF_HELPER_3(vfp_touhd, i64, f64, i32, ptr)
-DEF_HELPER_3(vfp_tould, i64, f64, i32, ptr)
-DEF_HELPER_3(vfp_shtos, f32, i32, i32, ptr)
-DEF_HELPER_3(vfp_sltos, f32, i32, i32, ptr)
-DEF_HELPER_3(vfp_uhtos, f32, i32, i32, ptr)
-DEF_HELPER_3(vfp_ultos, f32, i32, i32, ptr)
-DEF_HELPER_3(vfp_shtod, f64, i64, i32, ptr)
-DEF_HELPER_3(vfp_sltod, f64, i64, i32, ptr)
-DEF_HELPER_3(vfp_uhtod, f64, i64, i32, ptr)
-DEF_HELPER_3(vfp_ultod, f64, i64, i32, ptr)
-
-DEF_HELPER_2(vfp_fcvt_f16_to_f32, f32, i32, env)
-DEF_HELPER_2(vfp_fcvt_f32_to_f16, i32, f32, env)
-DEF_HELPER_2(neon_fcvt_f16_to_f32, f32, i32, env)
-DEF_HELPER_2(neon_fcvt_f32_to_f16, i32, f32, env)
-
-DEF_HELPER_4(vfp_muladdd, f64, f64, f64, f64, ptr)
-DEF_HELPER_4(vfp_muladds, f32, f32, f32, f32, ptr)
-
-DEF_HELPER_2(rints_exact, f32, f32, ptr)
-DEF_HELPER_2(rintd_exact, f64, f64, ptr)
-DEF_HELPER_2(rints, f32, f32, ptr)
-DEF_HELPER_2(rintd, f64, f64, ptr)
-
-DEF_HELPER_3(recps_f32, f32, f32, f32, env)
-DEF_HELPER_3(rsqrts_f32, f32, f32, f32, env)
-DEF_HELPER_2(recpe_f32, f32, f32, env)
-DEF_HELPER_2(rsqrte_f32, f32, f32, env)
-DEF_HELPER_2(recpe_u32, i32, i32, env)
-DEF_HELPER_2(rsqrte_u32, i32, i32, env)
-DEF_HELPER_4(neon_tbl, i32, i32, i32, i32, i32)
+DEF_HELPER_FLAGS_3(vfp_maxnums, TCG_CALL_NO_RWG, f32, f32, f32, ptr)
+DEF_HELPER_FLAGS_3(vfp_maxnumd, TCG_CALL_NO_RWG, f64, f64, f64, ptr)
+DEF_HELPER_FLAGS_3(vfp_minnums, TCG_CALL_NO_RWG, f32, f32, f32, ptr)
+DEF_HELPER_FLAGS_3(vfp_minnumd, TCG_CALL_NO_RWG, f64, f64, f64, ptr)
+
+DEF_HELPER_FLAGS_2(vfp_fcvtds, TCG_CALL_NO_RWG, f64, f32, env)
+DEF_HELPER_FLAGS_2(vfp_fcvtsd, TCG_CALL_NO_RWG, f32, f64, env)
+
+DEF_HELPER_FLAGS_2(vfp_uitos, TCG_CALL_NO_RWG, f32, i32, ptr)
+DEF_HELPER_FLAGS_2(vfp_uitod, TCG_CALL_NO_RWG, f64, i32, ptr)
+DEF_HELPER_FLAGS_2(vfp_sitos, TCG_CALL_NO_RWG, f32, i32, ptr)
+DEF_HELPER_FLAGS_2(vfp_sitod, TCG_CALL_NO_RWG, f64, i32, ptr)
+
+DEF_HELPER_FLAGS_2(vfp_touis, TCG_CALL_NO_RWG, i32, f32, ptr)
+DEF_HELPER_FLAGS_2(vfp_touid, TCG_CALL_NO_RWG, i32, f64, ptr)
+DEF_HELPER_FLAGS_2(vfp_touizs, TCG_CALL_NO_RWG, i32, f32, ptr)
+DEF_HELPER_FLAGS_2(vfp_touizd, TCG_CALL_NO_RWG, i32, f64, ptr)
+DEF_HELPER_FLAGS_2(vfp_tosis, TCG_CALL_NO_RWG, i32, f32, ptr)
+DEF_HELPER_FLAGS_2(vfp_tosid, TCG_CALL_NO_RWG, i32, f64, ptr)
+DEF_HELPER_FLAGS_2(vfp_tosizs, TCG_CALL_NO_RWG, i32, f32, ptr)
+DEF_HELPER_FLAGS_2(vfp_tosizd, TCG_CALL_NO_RWG, i32, f64, ptr)
+
+DEF_HELPER_FLAGS_3(vfp_toshs, TCG_CALL_NO_RWG, i32, f32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_tosls, TCG_CALL_NO_RWG, i32, f32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_touhs, TCG_CALL_NO_RWG, i32, f32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_touls, TCG_CALL_NO_RWG, i32, f32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_toshd, TCG_CALL_NO_RWG, i64, f64, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_tosld, TCG_CALL_NO_RWG, i64, f64, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_touhd, TCG_CALL_NO_RWG, i64, f64, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_tould, TCG_CALL_NO_RWG, i64, f64, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_shtos, TCG_CALL_NO_RWG, f32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_sltos, TCG_CALL_NO_RWG, f32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_uhtos, TCG_CALL_NO_RWG, f32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_ultos, TCG_CALL_NO_RWG, f32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_shtod, TCG_CALL_NO_RWG, f64, i64, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_sltod, TCG_CALL_NO_RWG, f64, i64, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_uhtod, TCG_CALL_NO_RWG, f64, i64, i32, ptr)
+DEF_HELPER_FLAGS_3(vfp_ultod, TCG_CALL_NO_RWG, f64, i64, i32, ptr)
+
+DEF_HELPER_FLAGS_2(vfp_fcvt_f16_to_f32, TCG_CALL_NO_RWG, f32, i32, env)
+DEF_HELPER_FLAGS_2(vfp_fcvt_f32_to_f16, TCG_CALL_NO_RWG, i32, f32, env)
+DEF_HELPER_FLAGS_2(neon_fcvt_f16_to_f32, TCG_CALL_NO_RWG, f32, i32, env)
+DEF_HELPER_FLAGS_2(neon_fcvt_f32_to_f16, TCG_CALL_NO_RWG, i32, f32, env)
+
+DEF_HELPER_FLAGS_4(vfp_muladdd, TCG_CALL_NO_RWG, f64, f64, f64, f64, ptr)
+DEF_HELPER_FLAGS_4(vfp_muladds, TCG_CALL_NO_RWG, f32, f32, f32, f32, ptr)
+
+DEF_HELPER_FLAGS_2(rints_exact, TCG_CALL_NO_RWG, f32, f32, ptr)
+DEF_HELPER_FLAGS_2(rintd_exact, TCG_CALL_NO_RWG, f64, f64, ptr)
+DEF_HELPER_FLAGS_2(rints, TCG_CALL_NO_RWG, f32, f32, ptr)
+DEF_HELPER_FLAGS_2(rintd, TCG_CALL_NO_RWG, f64, f64, ptr)
+
+DEF_HELPER_FLAGS_3(recps_f32, TCG_CALL_NO_RWG, f32, f32, f32, env)
+DEF_HELPER_FLAGS_3(rsqrts_f32, TCG_CALL_NO_RWG, f32, f32, f32, env)
+DEF_HELPER_FLAGS_2(recpe_f32, TCG_CALL_NO_RWG, f32, f32, env)
+DEF_HELPER_FLAGS_2(rsqrte_f32, TCG_CALL_NO_RWG, f32, f32, env)
+DEF_HELPER_FLAGS_2(recpe_u32, TCG_CALL_NO_RWG, i32, i32, env)
+DEF_HELPER_FLAGS_2(rsqrte_u32, TCG_CALL_NO_RWG, i32, i32, env)
+DEF_HELPER_FLAGS_4(neon_tbl, TCG_CALL_NO_RWG, i32, i32, i32, i32, i32)
 
 DEF_HELPER_2(add_cc, i32, i32, i32)
 DEF_HELPER_2(adc_cc, i32, i32, i32)
@@ -199,209 +199,209 @@ DEF_HELPER_2(sar_cc, i32, i32, i32)
 DEF_HELPER_2(ror_cc, i32, i32, i32)
 
 /* neon_helper.c */
-DEF_HELPER_3(neon_qadd_u8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qadd_s8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qadd_u16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qadd_s16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qadd_u32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qadd_s32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qsub_u8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qsub_s8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qsub_u16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qsub_s16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qsub_u32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qsub_s32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qadd_u64, i64, env, i64, i64)
-DEF_HELPER_3(neon_qadd_s64, i64, env, i64, i64)
-DEF_HELPER_3(neon_qsub_u64, i64, env, i64, i64)
-DEF_HELPER_3(neon_qsub_s64, i64, env, i64, i64)
-
-DEF_HELPER_2(neon_hadd_s8, i32, i32, i32)
-DEF_HELPER_2(neon_hadd_u8, i32, i32, i32)
-DEF_HELPER_2(neon_hadd_s16, i32, i32, i32)
-DEF_HELPER_2(neon_hadd_u16, i32, i32, i32)
-DEF_HELPER_2(neon_hadd_s32, s32, s32, s32)
-DEF_HELPER_2(neon_hadd_u32, i32, i32, i32)
-DEF_HELPER_2(neon_rhadd_s8, i32, i32, i32)
-DEF_HELPER_2(neon_rhadd_u8, i32, i32, i32)
-DEF_HELPER_2(neon_rhadd_s16, i32, i32, i32)
-DEF_HELPER_2(neon_rhadd_u16, i32, i32, i32)
-DEF_HELPER_2(neon_rhadd_s32, s32, s32, s32)
-DEF_HELPER_2(neon_rhadd_u32, i32, i32, i32)
-DEF_HELPER_2(neon_hsub_s8, i32, i32, i32)
-DEF_HELPER_2(neon_hsub_u8, i32, i32, i32)
-DEF_HELPER_2(neon_hsub_s16, i32, i32, i32)
-DEF_HELPER_2(neon_hsub_u16, i32, i32, i32)
-DEF_HELPER_2(neon_hsub_s32, s32, s32, s32)
-DEF_HELPER_2(neon_hsub_u32, i32, i32, i32)
-
-DEF_HELPER_2(neon_cgt_u8, i32, i32, i32)
-DEF_HELPER_2(neon_cgt_s8, i32, i32, i32)
-DEF_HELPER_2(neon_cgt_u16, i32, i32, i32)
-DEF_HELPER_2(neon_cgt_s16, i32, i32, i32)
-DEF_HELPER_2(neon_cgt_u32, i32, i32, i32)
-DEF_HELPER_2(neon_cgt_s32, i32, i32, i32)
-DEF_HELPER_2(neon_cge_u8, i32, i32, i32)
-DEF_HELPER_2(neon_cge_s8, i32, i32, i32)
-DEF_HELPER_2(neon_cge_u16, i32, i32, i32)
-DEF_HELPER_2(neon_cge_s16, i32, i32, i32)
-DEF_HELPER_2(neon_cge_u32, i32, i32, i32)
-DEF_HELPER_2(neon_cge_s32, i32, i32, i32)
-
-DEF_HELPER_2(neon_min_u8, i32, i32, i32)
-DEF_HELPER_2(neon_min_s8, i32, i32, i32)
-DEF_HELPER_2(neon_min_u16, i32, i32, i32)
-DEF_HELPER_2(neon_min_s16, i32, i32, i32)
-DEF_HELPER_2(neon_min_u32, i32, i32, i32)
-DEF_HELPER_2(neon_min_s32, i32, s32, s32)
-DEF_HELPER_2(neon_max_u8, i32, i32, i32)
-DEF_HELPER_2(neon_max_s8, i32, i32, i32)
-DEF_HELPER_2(neon_max_u16, i32, i32, i32)
-DEF_HELPER_2(neon_max_s16, i32, i32, i32)
-DEF_HELPER_2(neon_max_u32, i32, i32, i32)
-DEF_HELPER_2(neon_max_s32, i32, s32, s32)
-DEF_HELPER_2(neon_pmin_u8, i32, i32, i32)
-DEF_HELPER_2(neon_pmin_s8, i32, i32, i32)
-DEF_HELPER_2(neon_pmin_u16, i32, i32, i32)
-DEF_HELPER_2(neon_pmin_s16, i32, i32, i32)
-DEF_HELPER_2(neon_pmax_u8, i32, i32, i32)
-DEF_HELPER_2(neon_pmax_s8, i32, i32, i32)
-DEF_HELPER_2(neon_pmax_u16, i32, i32, i32)
-DEF_HELPER_2(neon_pmax_s16, i32, i32, i32)
-
-DEF_HELPER_2(neon_abd_u8, i32, i32, i32)
-DEF_HELPER_2(neon_abd_s8, i32, i32, i32)
-DEF_HELPER_2(neon_abd_u16, i32, i32, i32)
-DEF_HELPER_2(neon_abd_s16, i32, i32, i32)
-DEF_HELPER_2(neon_abd_u32, i32, i32, i32)
-DEF_HELPER_2(neon_abd_s32, i32, s32, s32)
-
-DEF_HELPER_2(neon_shl_u8, i32, i32, i32)
-DEF_HELPER_2(neon_shl_s8, i32, i32, i32)
-DEF_HELPER_2(neon_shl_u16, i32, i32, i32)
-DEF_HELPER_2(neon_shl_s16, i32, i32, i32)
-DEF_HELPER_2(neon_shl_u32, i32, i32, i32)
-DEF_HELPER_2(neon_shl_s32, i32, i32, i32)
-DEF_HELPER_2(neon_shl_u64, i64, i64, i64)
-DEF_HELPER_2(neon_shl_s64, i64, i64, i64)
-DEF_HELPER_2(neon_rshl_u8, i32, i32, i32)
-DEF_HELPER_2(neon_rshl_s8, i32, i32, i32)
-DEF_HELPER_2(neon_rshl_u16, i32, i32, i32)
-DEF_HELPER_2(neon_rshl_s16, i32, i32, i32)
-DEF_HELPER_2(neon_rshl_u32, i32, i32, i32)
-DEF_HELPER_2(neon_rshl_s32, i32, i32, i32)
-DEF_HELPER_2(neon_rshl_u64, i64, i64, i64)
-DEF_HELPER_2(neon_rshl_s64, i64, i64, i64)
-DEF_HELPER_3(neon_qshl_u8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qshl_s8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qshl_u16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qshl_s16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qshl_u32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qshl_s32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qshl_u64, i64, env, i64, i64)
-DEF_HELPER_3(neon_qshl_s64, i64, env, i64, i64)
-DEF_HELPER_3(neon_qshlu_s8, i32, env, i32, i32);
-DEF_HELPER_3(neon_qshlu_s16, i32, env, i32, i32);
-DEF_HELPER_3(neon_qshlu_s32, i32, env, i32, i32);
-DEF_HELPER_3(neon_qshlu_s64, i64, env, i64, i64);
-DEF_HELPER_3(neon_qrshl_u8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrshl_s8, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrshl_u16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrshl_s16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrshl_u32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrshl_s32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrshl_u64, i64, env, i64, i64)
-DEF_HELPER_3(neon_qrshl_s64, i64, env, i64, i64)
-
-DEF_HELPER_2(neon_add_u8, i32, i32, i32)
-DEF_HELPER_2(neon_add_u16, i32, i32, i32)
-DEF_HELPER_2(neon_padd_u8, i32, i32, i32)
-DEF_HELPER_2(neon_padd_u16, i32, i32, i32)
-DEF_HELPER_2(neon_sub_u8, i32, i32, i32)
-DEF_HELPER_2(neon_sub_u16, i32, i32, i32)
-DEF_HELPER_2(neon_mul_u8, i32, i32, i32)
-DEF_HELPER_2(neon_mul_u16, i32, i32, i32)
-DEF_HELPER_2(neon_mul_p8, i32, i32, i32)
-DEF_HELPER_2(neon_mull_p8, i64, i32, i32)
-
-DEF_HELPER_2(neon_tst_u8, i32, i32, i32)
-DEF_HELPER_2(neon_tst_u16, i32, i32, i32)
-DEF_HELPER_2(neon_tst_u32, i32, i32, i32)
-DEF_HELPER_2(neon_ceq_u8, i32, i32, i32)
-DEF_HELPER_2(neon_ceq_u16, i32, i32, i32)
-DEF_HELPER_2(neon_ceq_u32, i32, i32, i32)
-
-DEF_HELPER_1(neon_abs_s8, i32, i32)
-DEF_HELPER_1(neon_abs_s16, i32, i32)
-DEF_HELPER_1(neon_clz_u8, i32, i32)
-DEF_HELPER_1(neon_clz_u16, i32, i32)
-DEF_HELPER_1(neon_cls_s8, i32, i32)
-DEF_HELPER_1(neon_cls_s16, i32, i32)
-DEF_HELPER_1(neon_cls_s32, i32, i32)
-DEF_HELPER_1(neon_cnt_u8, i32, i32)
-
-DEF_HELPER_3(neon_qdmulh_s16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrdmulh_s16, i32, env, i32, i32)
-DEF_HELPER_3(neon_qdmulh_s32, i32, env, i32, i32)
-DEF_HELPER_3(neon_qrdmulh_s32, i32, env, i32, i32)
-
-DEF_HELPER_1(neon_narrow_u8, i32, i64)
-DEF_HELPER_1(neon_narrow_u16, i32, i64)
-DEF_HELPER_2(neon_unarrow_sat8, i32, env, i64)
-DEF_HELPER_2(neon_narrow_sat_u8, i32, env, i64)
-DEF_HELPER_2(neon_narrow_sat_s8, i32, env, i64)
-DEF_HELPER_2(neon_unarrow_sat16, i32, env, i64)
-DEF_HELPER_2(neon_narrow_sat_u16, i32, env, i64)
-DEF_HELPER_2(neon_narrow_sat_s16, i32, env, i64)
-DEF_HELPER_2(neon_unarrow_sat32, i32, env, i64)
-DEF_HELPER_2(neon_narrow_sat_u32, i32, env, i64)
-DEF_HELPER_2(neon_narrow_sat_s32, i32, env, i64)
-DEF_HELPER_1(neon_narrow_high_u8, i32, i64)
-DEF_HELPER_1(neon_narrow_high_u16, i32, i64)
-DEF_HELPER_1(neon_narrow_round_high_u8, i32, i64)
-DEF_HELPER_1(neon_narrow_round_high_u16, i32, i64)
-DEF_HELPER_1(neon_widen_u8, i64, i32)
-DEF_HELPER_1(neon_widen_s8, i64, i32)
-DEF_HELPER_1(neon_widen_u16, i64, i32)
-DEF_HELPER_1(neon_widen_s16, i64, i32)
-
-DEF_HELPER_2(neon_addl_u16, i64, i64, i64)
-DEF_HELPER_2(neon_addl_u32, i64, i64, i64)
-DEF_HELPER_2(neon_paddl_u16, i64, i64, i64)
-DEF_HELPER_2(neon_paddl_u32, i64, i64, i64)
-DEF_HELPER_2(neon_subl_u16, i64, i64, i64)
-DEF_HELPER_2(neon_subl_u32, i64, i64, i64)
-DEF_HELPER_3(neon_addl_saturate_s32, i64, env, i64, i64)
-DEF_HELPER_3(neon_addl_saturate_s64, i64, env, i64, i64)
-DEF_HELPER_2(neon_abdl_u16, i64, i32, i32)
-DEF_HELPER_2(neon_abdl_s16, i64, i32, i32)
-DEF_HELPER_2(neon_abdl_u32, i64, i32, i32)
-DEF_HELPER_2(neon_abdl_s32, i64, i32, i32)
-DEF_HELPER_2(neon_abdl_u64, i64, i32, i32)
-DEF_HELPER_2(neon_abdl_s64, i64, i32, i32)
-DEF_HELPER_2(neon_mull_u8, i64, i32, i32)
-DEF_HELPER_2(neon_mull_s8, i64, i32, i32)
-DEF_HELPER_2(neon_mull_u16, i64, i32, i32)
-DEF_HELPER_2(neon_mull_s16, i64, i32, i32)
-
-DEF_HELPER_1(neon_negl_u16, i64, i64)
-DEF_HELPER_1(neon_negl_u32, i64, i64)
-
-DEF_HELPER_2(neon_qabs_s8, i32, env, i32)
-DEF_HELPER_2(neon_qabs_s16, i32, env, i32)
-DEF_HELPER_2(neon_qabs_s32, i32, env, i32)
-DEF_HELPER_2(neon_qneg_s8, i32, env, i32)
-DEF_HELPER_2(neon_qneg_s16, i32, env, i32)
-DEF_HELPER_2(neon_qneg_s32, i32, env, i32)
-
-DEF_HELPER_3(neon_min_f32, i32, i32, i32, ptr)
-DEF_HELPER_3(neon_max_f32, i32, i32, i32, ptr)
-DEF_HELPER_3(neon_abd_f32, i32, i32, i32, ptr)
-DEF_HELPER_3(neon_ceq_f32, i32, i32, i32, ptr)
-DEF_HELPER_3(neon_cge_f32, i32, i32, i32, ptr)
-DEF_HELPER_3(neon_cgt_f32, i32, i32, i32, ptr)
-DEF_HELPER_3(neon_acge_f32, i32, i32, i32, ptr)
-DEF_HELPER_3(neon_acgt_f32, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_qadd_u8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qadd_s8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qadd_u16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qadd_s16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qadd_u32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qadd_s32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qsub_u8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qsub_s8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qsub_u16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qsub_s16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qsub_u32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qsub_s32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qadd_u64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_3(neon_qadd_s64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_3(neon_qsub_u64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_3(neon_qsub_s64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+
+DEF_HELPER_FLAGS_2(neon_hadd_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hadd_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hadd_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hadd_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hadd_s32, TCG_CALL_NO_RWG, s32, s32, s32)
+DEF_HELPER_FLAGS_2(neon_hadd_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rhadd_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rhadd_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rhadd_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rhadd_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rhadd_s32, TCG_CALL_NO_RWG, s32, s32, s32)
+DEF_HELPER_FLAGS_2(neon_rhadd_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hsub_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hsub_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hsub_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hsub_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_hsub_s32, TCG_CALL_NO_RWG, s32, s32, s32)
+DEF_HELPER_FLAGS_2(neon_hsub_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+
+DEF_HELPER_FLAGS_2(neon_cgt_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cgt_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cgt_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cgt_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cgt_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cgt_s32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cge_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cge_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cge_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cge_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cge_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_cge_s32, TCG_CALL_NO_RWG, i32, i32, i32)
+
+DEF_HELPER_FLAGS_2(neon_min_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_min_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_min_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_min_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_min_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_min_s32, TCG_CALL_NO_RWG, i32, s32, s32)
+DEF_HELPER_FLAGS_2(neon_max_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_max_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_max_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_max_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_max_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_max_s32, TCG_CALL_NO_RWG, i32, s32, s32)
+DEF_HELPER_FLAGS_2(neon_pmin_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_pmin_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_pmin_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_pmin_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_pmax_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_pmax_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_pmax_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_pmax_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+
+DEF_HELPER_FLAGS_2(neon_abd_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abd_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abd_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abd_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abd_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abd_s32, TCG_CALL_NO_RWG, i32, s32, s32)
+
+DEF_HELPER_FLAGS_2(neon_shl_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_shl_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_shl_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_shl_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_shl_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_shl_s32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_shl_u64, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_shl_s64, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_rshl_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rshl_s8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rshl_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rshl_s16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rshl_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rshl_s32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_rshl_u64, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_rshl_s64, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_3(neon_qshl_u8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qshl_s8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qshl_u16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qshl_s16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qshl_u32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qshl_s32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qshl_u64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_3(neon_qshl_s64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_3(neon_qshlu_s8, TCG_CALL_NO_RWG, i32, env, i32, i32);
+DEF_HELPER_FLAGS_3(neon_qshlu_s16, TCG_CALL_NO_RWG, i32, env, i32, i32);
+DEF_HELPER_FLAGS_3(neon_qshlu_s32, TCG_CALL_NO_RWG, i32, env, i32, i32);
+DEF_HELPER_FLAGS_3(neon_qshlu_s64, TCG_CALL_NO_RWG, i64, env, i64, i64);
+DEF_HELPER_FLAGS_3(neon_qrshl_u8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrshl_s8, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrshl_u16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrshl_s16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrshl_u32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrshl_s32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrshl_u64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_3(neon_qrshl_s64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+
+DEF_HELPER_FLAGS_2(neon_add_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_add_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_padd_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_padd_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_sub_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_sub_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mul_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mul_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mul_p8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mull_p8, TCG_CALL_NO_RWG, i64, i32, i32)
+
+DEF_HELPER_FLAGS_2(neon_tst_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_tst_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_tst_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_ceq_u8, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_ceq_u16, TCG_CALL_NO_RWG, i32, i32, i32)
+DEF_HELPER_FLAGS_2(neon_ceq_u32, TCG_CALL_NO_RWG, i32, i32, i32)
+
+DEF_HELPER_FLAGS_1(neon_abs_s8, TCG_CALL_NO_RWG, i32, i32)
+DEF_HELPER_FLAGS_1(neon_abs_s16, TCG_CALL_NO_RWG, i32, i32)
+DEF_HELPER_FLAGS_1(neon_clz_u8, TCG_CALL_NO_RWG, i32, i32)
+DEF_HELPER_FLAGS_1(neon_clz_u16, TCG_CALL_NO_RWG, i32, i32)
+DEF_HELPER_FLAGS_1(neon_cls_s8, TCG_CALL_NO_RWG, i32, i32)
+DEF_HELPER_FLAGS_1(neon_cls_s16, TCG_CALL_NO_RWG, i32, i32)
+DEF_HELPER_FLAGS_1(neon_cls_s32, TCG_CALL_NO_RWG, i32, i32)
+DEF_HELPER_FLAGS_1(neon_cnt_u8, TCG_CALL_NO_RWG, i32, i32)
+
+DEF_HELPER_FLAGS_3(neon_qdmulh_s16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrdmulh_s16, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qdmulh_s32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qrdmulh_s32, TCG_CALL_NO_RWG, i32, env, i32, i32)
+
+DEF_HELPER_FLAGS_1(neon_narrow_u8, TCG_CALL_NO_RWG, i32, i64)
+DEF_HELPER_FLAGS_1(neon_narrow_u16, TCG_CALL_NO_RWG, i32, i64)
+DEF_HELPER_FLAGS_2(neon_unarrow_sat8, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_narrow_sat_u8, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_narrow_sat_s8, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_unarrow_sat16, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_narrow_sat_u16, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_narrow_sat_s16, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_unarrow_sat32, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_narrow_sat_u32, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_2(neon_narrow_sat_s32, TCG_CALL_NO_RWG, i32, env, i64)
+DEF_HELPER_FLAGS_1(neon_narrow_high_u8, TCG_CALL_NO_RWG, i32, i64)
+DEF_HELPER_FLAGS_1(neon_narrow_high_u16, TCG_CALL_NO_RWG, i32, i64)
+DEF_HELPER_FLAGS_1(neon_narrow_round_high_u8, TCG_CALL_NO_RWG, i32, i64)
+DEF_HELPER_FLAGS_1(neon_narrow_round_high_u16, TCG_CALL_NO_RWG, i32, i64)
+DEF_HELPER_FLAGS_1(neon_widen_u8, TCG_CALL_NO_RWG, i64, i32)
+DEF_HELPER_FLAGS_1(neon_widen_s8, TCG_CALL_NO_RWG, i64, i32)
+DEF_HELPER_FLAGS_1(neon_widen_u16, TCG_CALL_NO_RWG, i64, i32)
+DEF_HELPER_FLAGS_1(neon_widen_s16, TCG_CALL_NO_RWG, i64, i32)
+
+DEF_HELPER_FLAGS_2(neon_addl_u16, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_addl_u32, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_paddl_u16, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_paddl_u32, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_subl_u16, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_2(neon_subl_u32, TCG_CALL_NO_RWG, i64, i64, i64)
+DEF_HELPER_FLAGS_3(neon_addl_saturate_s32, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_3(neon_addl_saturate_s64, TCG_CALL_NO_RWG, i64, env, i64, i64)
+DEF_HELPER_FLAGS_2(neon_abdl_u16, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abdl_s16, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abdl_u32, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abdl_s32, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abdl_u64, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_abdl_s64, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mull_u8, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mull_s8, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mull_u16, TCG_CALL_NO_RWG, i64, i32, i32)
+DEF_HELPER_FLAGS_2(neon_mull_s16, TCG_CALL_NO_RWG, i64, i32, i32)
+
+DEF_HELPER_FLAGS_1(neon_negl_u16, TCG_CALL_NO_RWG, i64, i64)
+DEF_HELPER_FLAGS_1(neon_negl_u32, TCG_CALL_NO_RWG, i64, i64)
+
+DEF_HELPER_FLAGS_2(neon_qabs_s8, TCG_CALL_NO_RWG, i32, env, i32)
+DEF_HELPER_FLAGS_2(neon_qabs_s16, TCG_CALL_NO_RWG, i32, env, i32)
+DEF_HELPER_FLAGS_2(neon_qabs_s32, TCG_CALL_NO_RWG, i32, env, i32)
+DEF_HELPER_FLAGS_2(neon_qneg_s8, TCG_CALL_NO_RWG, i32, env, i32)
+DEF_HELPER_FLAGS_2(neon_qneg_s16, TCG_CALL_NO_RWG, i32, env, i32)
+DEF_HELPER_FLAGS_2(neon_qneg_s32, TCG_CALL_NO_RWG, i32, env, i32)
+
+DEF_HELPER_FLAGS_3(neon_min_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_max_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_abd_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_ceq_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_cge_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_cgt_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_acge_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
+DEF_HELPER_FLAGS_3(neon_acgt_f32, TCG_CALL_NO_RWG, i32, i32, i32, ptr)
 
 /* iwmmxt_helper.c */
 DEF_HELPER_2(iwmmxt_maddsq, i64, i64, i64)
@@ -502,16 +502,16 @@ DEF_HELPER_3(iwmmxt_muladdswl, i64, i64, i32, i32)
 
 DEF_HELPER_2(set_teecr, void, env, i32)
 
-DEF_HELPER_3(neon_unzip8, void, env, i32, i32)
-DEF_HELPER_3(neon_unzip16, void, env, i32, i32)
-DEF_HELPER_3(neon_qunzip8, void, env, i32, i32)
-DEF_HELPER_3(neon_qunzip16, void, env, i32, i32)
-DEF_HELPER_3(neon_qunzip32, void, env, i32, i32)
-DEF_HELPER_3(neon_zip8, void, env, i32, i32)
-DEF_HELPER_3(neon_zip16, void, env, i32, i32)
-DEF_HELPER_3(neon_qzip8, void, env, i32, i32)
-DEF_HELPER_3(neon_qzip16, void, env, i32, i32)
-DEF_HELPER_3(neon_qzip32, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_unzip8, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_unzip16, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qunzip8, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qunzip16, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qunzip32, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_zip8, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_zip16, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qzip8, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qzip16, TCG_CALL_NO_RWG, void, env, i32, i32)
+DEF_HELPER_FLAGS_3(neon_qzip32, TCG_CALL_NO_RWG, void, env, i32, i32)
 
 DEF_HELPER_0(set_system_event, void)
 
@@ -527,731 +527,731 @@ DEF_HELPER_3(pmu_update_event_counters, void, env, int, i32)
 DEF_HELPER_1(pmu_count_instructions_cycles, void, i32)
 
 #ifdef TARGET_PROTO_ARM_M
-DEF_HELPER_2(mve_vctp, void, env, i32)
-
-DEF_HELPER_3(mve_vldrb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrb_sh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrb_sw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrb_uh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrb_uw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrh_sw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vldrh_uw, void, env, ptr, i32)
-
-DEF_HELPER_3(mve_vstrb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vstrh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vstrw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vstrb_h, void, env, ptr, i32)
-DEF_HELPER_3(mve_vstrb_w, void, env, ptr, i32)
-DEF_HELPER_3(mve_vstrh_w, void, env, ptr, i32)
-
-DEF_HELPER_3(mve_vdup, void, env, ptr, i32)
-
-DEF_HELPER_3(mve_vfcmp_eqs, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vfcmp_nes, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vfcmp_ges, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vfcmp_les, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vfcmp_gts, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vfcmp_lts, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vfcmp_eq_scalars, void, env, ptr, i32)
-DEF_HELPER_3(mve_vfcmp_ne_scalars, void, env, ptr, i32)
-DEF_HELPER_3(mve_vfcmp_ge_scalars, void, env, ptr, i32)
-DEF_HELPER_3(mve_vfcmp_le_scalars, void, env, ptr, i32)
-DEF_HELPER_3(mve_vfcmp_gt_scalars, void, env, ptr, i32)
-DEF_HELPER_3(mve_vfcmp_lt_scalars, void, env, ptr, i32)
-
-DEF_HELPER_4(mve_vhaddsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhaddsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhaddsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhaddub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhadduh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhadduw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vrhaddsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrhaddsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrhaddsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrhaddub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrhadduh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrhadduw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vhsubsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhsubsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhsubsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhsubub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhsubuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhsubuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_3(mve_vmaxvsb, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxvsh, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxvsw, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxvub, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxvuh, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxvuw, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxavb, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxavh, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxavw, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminvsb, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminvsh, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminvsw, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminvub, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminvuh, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminvuw, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminavb, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminavh, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminavw, i32, env, ptr, i32)
-DEF_HELPER_4(mve_vmaxnms, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vminnms, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmaxnmas, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vminnmas, void, env, ptr, ptr, ptr)
-DEF_HELPER_3(mve_vmaxnmvs, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminnmvs, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vmaxnmavs, i32, env, ptr, i32)
-DEF_HELPER_3(mve_vminnmavs, i32, env, ptr, i32)
-
-DEF_HELPER_4(mve_vfmul_scalars, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vfadd_scalars, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vfsub_scalars, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vfma_scalars, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vfmas_scalars, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vfadds, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vfsubs, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vfmuls, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vidupb, i32, env, ptr, i32, i32)
-DEF_HELPER_4(mve_viduph, i32, env, ptr, i32, i32)
-DEF_HELPER_4(mve_vidupw, i32, env, ptr, i32, i32)
-
-DEF_HELPER_4(mve_vand, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vbic, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vorr, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vorn, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_veor, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vpsel, void, env, ptr, ptr, ptr)
-DEF_HELPER_1(mve_vpnot, void, env)
-
-DEF_HELPER_4(mve_vcmul0s, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcmul90s, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcmul180s, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcmul270s, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_5(mve_viwdupb, i32, env, ptr, i32, i32, i32)
-DEF_HELPER_5(mve_viwduph, i32, env, ptr, i32, i32, i32)
-DEF_HELPER_5(mve_viwdupw, i32, env, ptr, i32, i32, i32)
-
-DEF_HELPER_5(mve_vdwdupb, i32, env, ptr, i32, i32, i32)
-DEF_HELPER_5(mve_vdwduph, i32, env, ptr, i32, i32, i32)
-DEF_HELPER_5(mve_vdwdupw, i32, env, ptr, i32, i32, i32)
-
-DEF_HELPER_3(mve_vclzb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vclzh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vclzw, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vclsb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vclsh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vclsw, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vabsb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vabsh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vabsw, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vnegb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vnegh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vnegw, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vfabss, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vfabsh, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vfnegs, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vfnegh, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vqabsb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqabsh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqabsw, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vqnegb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqnegh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqnegw, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vmvn, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vmaxab, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vmaxah, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vmaxaw, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vminab, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vminah, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vminaw, void, env, ptr, ptr)
-
-DEF_HELPER_4(mve_vcvt_s_rm_s, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vcvt_u_rm_s, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vrint_rm_s, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrintx_rm_s, void, env, ptr, ptr, i32)
-
-DEF_HELPER_3(mve_vrev16b, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vrev32b, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vrev32h, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vrev64b, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vrev64h, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vrev64w, void, env, ptr, ptr)
-
-DEF_HELPER_4(mve_vaddb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vaddh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vaddw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vadc, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vadci, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vsbc, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vsbci, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vcadd90b, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcadd90h, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcadd90w, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vcadd270b, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcadd270h, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcadd270w, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vhcadd90b, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhcadd90h, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhcadd90w, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vhcadd270b, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhcadd270h, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vhcadd270w, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vadd_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vadd_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vadd_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vsub_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vsub_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vsub_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vmul_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmul_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmul_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vhadds_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhadds_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhadds_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vhaddu_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhaddu_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhaddu_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vhsubs_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhsubs_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhsubs_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vhsubu_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhsubu_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vhsubu_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vsubb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vsubh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vsubw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmulb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmaxsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmaxsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmaxsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmaxub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmaxuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmaxuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vminsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vminsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vminsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vminub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vminuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vminuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vcvt_sf, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vcvt_uf, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vcvt_fs, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vcvt_fu, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vabavsb, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vabavsh, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vabavsw, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vabavub, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vabavuh, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vabavuw, i32, env, ptr, ptr, i32)
-
-DEF_HELPER_3(mve_vmovnbb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vmovnbh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vmovntb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vmovnth, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vqmovunbb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovunbh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovuntb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovunth, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vqmovnbsb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovnbsh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovntsb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovntsh, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vqmovnbub, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovnbuh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovntub, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vqmovntuh, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vmovi, void, env, ptr, i64)
-DEF_HELPER_3(mve_vandi, void, env, ptr, i64)
-DEF_HELPER_3(mve_vorri, void, env, ptr, i64)
-
-DEF_HELPER_4(mve_vshlsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vshlsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vshlsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vshlub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vshluh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vshluw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vrshlsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrshlsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrshlsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vrshlub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrshluh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrshluw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqaddsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqaddsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqaddsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqaddub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqadduh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqadduw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqadds_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqadds_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqadds_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqaddu_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqaddu_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqaddu_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqsubsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqsubsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqsubsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqsubub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqsubuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqsubuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqsubs_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqsubs_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqsubs_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqsubu_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqsubu_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqsubu_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqdmulh_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmulh_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmulh_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqrdmulh_scalarb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmulh_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmulh_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqshlsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqshlsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqshlsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqshlub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqshluh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqshluw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqrshlsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrshlsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrshlsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqrshlub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrshluh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrshluw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vshli_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshli_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshli_uw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vshli_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshli_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshli_sw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vrshli_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrshli_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrshli_sw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vrshli_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrshli_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrshli_uw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqshli_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshli_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshli_sw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqshli_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshli_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshli_uw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqshlui_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshlui_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshlui_sw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqrshli_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshli_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshli_sw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqrshli_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshli_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshli_uw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vshllbsb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshllbsh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshllbub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshllbuh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshlltsb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshlltsh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshlltub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshlltuh, void, env, ptr, ptr, i32)
-
-DEF_HELPER_3(mve_vcmpeqb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpeqh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpeqw, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpneb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpneh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpnew, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpcsb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpcsh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpcsw, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmphib, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmphih, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmphiw, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpgeb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpgeh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpgew, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpltb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmplth, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpltw, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpgtb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpgth, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpgtw, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpleb, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmpleh, void, env, ptr, ptr)
-DEF_HELPER_3(mve_vcmplew, void, env, ptr, ptr)
-
-DEF_HELPER_3(mve_vcmpeq_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpeq_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpeq_scalarw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpne_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpne_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpne_scalarw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpcs_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpcs_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpcs_scalarw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmphi_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmphi_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmphi_scalarw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpge_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpge_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpge_scalarw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmplt_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmplt_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmplt_scalarw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpgt_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpgt_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmpgt_scalarw, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmple_scalarb, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmple_scalarh, void, env, ptr, i32)
-DEF_HELPER_3(mve_vcmple_scalarw, void, env, ptr, i32)
-
-DEF_HELPER_4(mve_vmlab, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlah, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlaw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vmlasb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlash, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlasw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vmlaldavsh, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vmlaldavxsh, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vmlaldavsw, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vmlaldavxsw, i64, env, ptr, ptr, i64)
-
-DEF_HELPER_4(mve_vmlaldavuh, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vmlaldavuw, i64, env, ptr, ptr, i64)
-
-DEF_HELPER_4(mve_vmlsldavsh, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vmlsldavxsh, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vmlsldavsw, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vmlsldavxsw, i64, env, ptr, ptr, i64)
-
-DEF_HELPER_4(mve_vmladavsb, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmladavsh, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmladavsw, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmladavsxb, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmladavsxh, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmladavsxw, i32, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vmlsdavb, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlsdavh, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlsdavw, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlsdavxb, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlsdavxh, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmlsdavxw, i32, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vmladavub, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmladavuh, i32, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vmladavuw, i32, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vrmlaldavhsw, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vrmlaldavhxsw, i64, env, ptr, ptr, i64)
-
-DEF_HELPER_4(mve_vrmlaldavhuw, i64, env, ptr, ptr, i64)
-
-DEF_HELPER_4(mve_vrmlsldavhsw, i64, env, ptr, ptr, i64)
-DEF_HELPER_4(mve_vrmlsldavhxsw, i64, env, ptr, ptr, i64)
-
-DEF_HELPER_4(mve_vcmla0s, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcmla90s, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcmla180s, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vcmla270s, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vfcadd90s, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vfcadd270s, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmullbsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmullbsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmullbsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmullbub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmullbuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmullbuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmulltsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulltsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulltsw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmulltub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulltuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulltuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmullpbh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmullpbw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vmullpth, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmullptw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_3(mve_vaddvsb, i32, env, ptr, i32);
-DEF_HELPER_3(mve_vaddvsh, i32, env, ptr, i32);
-DEF_HELPER_3(mve_vaddvsw, i32, env, ptr, i32);
-DEF_HELPER_3(mve_vaddvub, i32, env, ptr, i32);
-DEF_HELPER_3(mve_vaddvuh, i32, env, ptr, i32);
-DEF_HELPER_3(mve_vaddvuw, i32, env, ptr, i32);
-
-DEF_HELPER_3(mve_vaddlvs, i64, env, ptr, i64)
-DEF_HELPER_3(mve_vaddlvu, i64, env, ptr, i64)
-
-DEF_HELPER_4(mve_vabdsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vabdsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vabdsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vabdub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vabduh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vabduw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vfabds, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_3(mve_uqshl, i32, env, i32, i32)
-DEF_HELPER_3(mve_sqshl, i32, env, i32, i32)
-DEF_HELPER_3(mve_uqrshl, i32, env, i32, i32)
-DEF_HELPER_3(mve_sqrshr, i32, env, i32, i32)
-
-DEF_HELPER_3(mve_sshrl, i64, env, i64, i32)
-DEF_HELPER_3(mve_ushll, i64, env, i64, i32)
-DEF_HELPER_3(mve_sqshll, i64, env, i64, i32)
-DEF_HELPER_3(mve_uqshll, i64, env, i64, i32)
-
-DEF_HELPER_3(mve_sqrshrl, i64, env, i64, i32)
-DEF_HELPER_3(mve_uqrshll, i64, env, i64, i32)
-DEF_HELPER_3(mve_sqrshrl48, i64, env, i64, i32)
-DEF_HELPER_3(mve_uqrshll48, i64, env, i64, i32)
-
-DEF_HELPER_4(mve_vfmas, void, env, ptr, ptr, ptr);
-DEF_HELPER_4(mve_vfmss, void, env, ptr, ptr, ptr);
-
-DEF_HELPER_4(mve_vqdmladhb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmladhh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmladhw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmladhxb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmladhxh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmladhxw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqrdmladhb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmladhh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmladhw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmladhxb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmladhxh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmladhxw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqdmlsdhb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmlsdhh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmlsdhw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmlsdhxb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmlsdhxh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmlsdhxw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqrdmlsdhb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmlsdhh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmlsdhw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmlsdhxb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmlsdhxh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmlsdhxw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vsrib, void, env, ptr, ptr, i32);
-DEF_HELPER_4(mve_vsrih, void, env, ptr, ptr, i32);
-DEF_HELPER_4(mve_vsriw, void, env, ptr, ptr, i32);
-
-DEF_HELPER_4(mve_vslib, void, env, ptr, ptr, i32);
-DEF_HELPER_4(mve_vslih, void, env, ptr, ptr, i32);
-DEF_HELPER_4(mve_vsliw, void, env, ptr, ptr, i32);
-
-DEF_HELPER_4(mve_vmulhsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulhsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulhsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulhub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulhuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vmulhuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vrmulhsb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrmulhsh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrmulhsw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrmulhub, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrmulhuh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vrmulhuw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqdmullbh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmullbw, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmullth, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmulltw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqdmullb_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmullb_scalarw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmullt_scalarh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmullt_scalarw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqdmulhb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmulhh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqdmulhw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqrdmulhb, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmulhh, void, env, ptr, ptr, ptr)
-DEF_HELPER_4(mve_vqrdmulhw, void, env, ptr, ptr, ptr)
-
-DEF_HELPER_4(mve_vqdmlahb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmlahh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmlahw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmlahb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmlahh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmlahw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqdmlashb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmlashh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqdmlashw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmlashb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmlashh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrdmlashw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqrshrnb_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrnb_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrnt_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrnt_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrnb_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrnb_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrnt_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrnt_uh, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqrshrunbb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrunbh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshruntb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqrshrunth, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vstrb_sg_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrb_sg_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrb_sg_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrh_sg_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrh_sg_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrw_sg_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrd_sg_ud, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vstrh_sg_os_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrh_sg_os_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrw_sg_os_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrd_sg_os_ud, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vstrw_sg_wb_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vstrd_sg_wb_ud, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vldrb_sg_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrb_sg_sw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrh_sg_sw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrb_sg_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrb_sg_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrb_sg_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrh_sg_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrh_sg_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrw_sg_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrd_sg_ud, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vldrh_sg_os_sw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrh_sg_os_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrh_sg_os_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrw_sg_os_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrd_sg_os_ud, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vldrw_sg_wb_uw, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vldrd_sg_wb_ud, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqshrnb_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrnb_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrnt_sb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrnt_sh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrnb_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrnb_uh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrnt_ub, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrnt_uh, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vqshrunbb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshruntb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrunbh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vqshrunth, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vbrsrb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vbrsrh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vbrsrw, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vshlc, i32, env, ptr, i32, i32)
-
-DEF_HELPER_4(mve_vshrnbb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshrnbh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshrntb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vshrnth, void, env, ptr, ptr, i32)
-
-DEF_HELPER_4(mve_vrshrnbb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrshrnbh, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrshrntb, void, env, ptr, ptr, i32)
-DEF_HELPER_4(mve_vrshrnth, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_2(mve_vctp, TCG_CALL_NO_WG, void, env, i32)
+
+DEF_HELPER_FLAGS_3(mve_vldrb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrb_sh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrb_sw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrb_uh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrb_uw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrh_sw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vldrh_uw, TCG_CALL_NO_WG, void, env, ptr, i32)
+
+DEF_HELPER_FLAGS_3(mve_vstrb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vstrh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vstrw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vstrb_h, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vstrb_w, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vstrh_w, TCG_CALL_NO_WG, void, env, ptr, i32)
+
+DEF_HELPER_FLAGS_3(mve_vdup, TCG_CALL_NO_WG, void, env, ptr, i32)
+
+DEF_HELPER_FLAGS_3(mve_vfcmp_eqs, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vfcmp_nes, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vfcmp_ges, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vfcmp_les, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vfcmp_gts, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vfcmp_lts, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vfcmp_eq_scalars, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vfcmp_ne_scalars, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vfcmp_ge_scalars, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vfcmp_le_scalars, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vfcmp_gt_scalars, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vfcmp_lt_scalars, TCG_CALL_NO_WG, void, env, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vhaddsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhaddsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhaddsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhaddub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhadduh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhadduw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vrhaddsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrhaddsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrhaddsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrhaddub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrhadduh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrhadduw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vhsubsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhsubsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhsubsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhsubub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhsubuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhsubuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vmaxvsb, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxvsh, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxvsw, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxvub, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxvuh, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxvuw, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxavb, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxavh, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxavw, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminvsb, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminvsh, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminvsw, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminvub, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminvuh, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminvuw, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminavb, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminavh, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminavw, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmaxnms, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vminnms, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmaxnmas, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vminnmas, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vmaxnmvs, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminnmvs, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vmaxnmavs, TCG_CALL_NO_WG, i32, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vminnmavs, TCG_CALL_NO_WG, i32, env, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vfmul_scalars, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vfadd_scalars, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vfsub_scalars, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vfma_scalars, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vfmas_scalars, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vfadds, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vfsubs, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vfmuls, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vidupb, TCG_CALL_NO_WG, i32, env, ptr, i32, i32)
+DEF_HELPER_FLAGS_4(mve_viduph, TCG_CALL_NO_WG, i32, env, ptr, i32, i32)
+DEF_HELPER_FLAGS_4(mve_vidupw, TCG_CALL_NO_WG, i32, env, ptr, i32, i32)
+
+DEF_HELPER_FLAGS_4(mve_vand, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vbic, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vorr, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vorn, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_veor, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vpsel, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_1(mve_vpnot, TCG_CALL_NO_WG, void, env)
+
+DEF_HELPER_FLAGS_4(mve_vcmul0s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcmul90s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcmul180s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcmul270s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_5(mve_viwdupb, TCG_CALL_NO_WG, i32, env, ptr, i32, i32, i32)
+DEF_HELPER_FLAGS_5(mve_viwduph, TCG_CALL_NO_WG, i32, env, ptr, i32, i32, i32)
+DEF_HELPER_FLAGS_5(mve_viwdupw, TCG_CALL_NO_WG, i32, env, ptr, i32, i32, i32)
+
+DEF_HELPER_FLAGS_5(mve_vdwdupb, TCG_CALL_NO_WG, i32, env, ptr, i32, i32, i32)
+DEF_HELPER_FLAGS_5(mve_vdwduph, TCG_CALL_NO_WG, i32, env, ptr, i32, i32, i32)
+DEF_HELPER_FLAGS_5(mve_vdwdupw, TCG_CALL_NO_WG, i32, env, ptr, i32, i32, i32)
+
+DEF_HELPER_FLAGS_3(mve_vclzb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vclzh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vclzw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vclsb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vclsh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vclsw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vabsb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vabsh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vabsw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vnegb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vnegh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vnegw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vfabss, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vfabsh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vfnegs, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vfnegh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vqabsb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqabsh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqabsw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vqnegb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqnegh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqnegw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vmvn, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vmaxab, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vmaxah, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vmaxaw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vminab, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vminah, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vminaw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vcvt_s_rm_s, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vcvt_u_rm_s, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vrint_rm_s, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrintx_rm_s, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_3(mve_vrev16b, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vrev32b, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vrev32h, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vrev64b, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vrev64h, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vrev64w, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vaddb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vaddh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vaddw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vadc, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vadci, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vsbc, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vsbci, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vcadd90b, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcadd90h, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcadd90w, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vcadd270b, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcadd270h, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcadd270w, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vhcadd90b, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhcadd90h, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhcadd90w, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vhcadd270b, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhcadd270h, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vhcadd270w, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vadd_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vadd_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vadd_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vsub_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vsub_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vsub_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vmul_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmul_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmul_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vhadds_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhadds_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhadds_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vhaddu_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhaddu_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhaddu_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vhsubs_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhsubs_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhsubs_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vhsubu_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhsubu_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vhsubu_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vsubb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vsubh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vsubw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmulb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmaxsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmaxsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmaxsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmaxub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmaxuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmaxuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vminsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vminsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vminsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vminub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vminuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vminuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vcvt_sf, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vcvt_uf, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vcvt_fs, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vcvt_fu, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vabavsb, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vabavsh, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vabavsw, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vabavub, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vabavuh, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vabavuw, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_3(mve_vmovnbb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vmovnbh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vmovntb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vmovnth, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vqmovunbb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovunbh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovuntb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovunth, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vqmovnbsb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovnbsh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovntsb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovntsh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vqmovnbub, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovnbuh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovntub, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vqmovntuh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vmovi, TCG_CALL_NO_WG, void, env, ptr, i64)
+DEF_HELPER_FLAGS_3(mve_vandi, TCG_CALL_NO_WG, void, env, ptr, i64)
+DEF_HELPER_FLAGS_3(mve_vorri, TCG_CALL_NO_WG, void, env, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vshlsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vshlsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vshlsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vshlub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vshluh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vshluw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vrshlsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrshlsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrshlsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vrshlub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrshluh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrshluw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqaddsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqaddsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqaddsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqaddub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqadduh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqadduw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqadds_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqadds_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqadds_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqaddu_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqaddu_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqaddu_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqsubsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqsubsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqsubsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqsubub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqsubuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqsubuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqsubs_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqsubs_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqsubs_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqsubu_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqsubu_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqsubu_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqdmulh_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmulh_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmulh_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqrdmulh_scalarb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmulh_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmulh_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqshlsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqshlsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqshlsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqshlub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqshluh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqshluw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqrshlsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrshlsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrshlsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqrshlub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrshluh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrshluw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vshli_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshli_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshli_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vshli_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshli_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshli_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vrshli_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrshli_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrshli_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vrshli_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrshli_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrshli_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqshli_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshli_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshli_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqshli_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshli_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshli_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqshlui_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshlui_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshlui_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqrshli_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshli_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshli_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqrshli_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshli_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshli_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vshllbsb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshllbsh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshllbub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshllbuh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshlltsb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshlltsh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshlltub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshlltuh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_3(mve_vcmpeqb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpeqh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpeqw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpneb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpneh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpnew, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpcsb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpcsh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpcsw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmphib, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmphih, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmphiw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpgeb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpgeh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpgew, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpltb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmplth, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpltw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpgtb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpgth, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpgtw, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpleb, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmpleh, TCG_CALL_NO_WG, void, env, ptr, ptr)
+DEF_HELPER_FLAGS_3(mve_vcmplew, TCG_CALL_NO_WG, void, env, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vcmpeq_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpeq_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpeq_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpne_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpne_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpne_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpcs_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpcs_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpcs_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmphi_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmphi_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmphi_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpge_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpge_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpge_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmplt_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmplt_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmplt_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpgt_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpgt_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmpgt_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmple_scalarb, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmple_scalarh, TCG_CALL_NO_WG, void, env, ptr, i32)
+DEF_HELPER_FLAGS_3(mve_vcmple_scalarw, TCG_CALL_NO_WG, void, env, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vmlab, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlah, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlaw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vmlasb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlash, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlasw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vmlaldavsh, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vmlaldavxsh, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vmlaldavsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vmlaldavxsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vmlaldavuh, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vmlaldavuw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vmlsldavsh, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vmlsldavxsh, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vmlsldavsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vmlsldavxsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vmladavsb, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmladavsh, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmladavsw, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmladavsxb, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmladavsxh, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmladavsxw, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vmlsdavb, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlsdavh, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlsdavw, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlsdavxb, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlsdavxh, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmlsdavxw, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vmladavub, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmladavuh, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vmladavuw, TCG_CALL_NO_WG, i32, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vrmlaldavhsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vrmlaldavhxsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vrmlaldavhuw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vrmlsldavhsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+DEF_HELPER_FLAGS_4(mve_vrmlsldavhxsw, TCG_CALL_NO_WG, i64, env, ptr, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vcmla0s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcmla90s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcmla180s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vcmla270s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vfcadd90s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vfcadd270s, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmullbsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmullbsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmullbsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmullbub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmullbuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmullbuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmulltsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulltsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulltsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmulltub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulltuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulltuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmullpbh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmullpbw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vmullpth, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmullptw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_vaddvsb, TCG_CALL_NO_WG, i32, env, ptr, i32);
+DEF_HELPER_FLAGS_3(mve_vaddvsh, TCG_CALL_NO_WG, i32, env, ptr, i32);
+DEF_HELPER_FLAGS_3(mve_vaddvsw, TCG_CALL_NO_WG, i32, env, ptr, i32);
+DEF_HELPER_FLAGS_3(mve_vaddvub, TCG_CALL_NO_WG, i32, env, ptr, i32);
+DEF_HELPER_FLAGS_3(mve_vaddvuh, TCG_CALL_NO_WG, i32, env, ptr, i32);
+DEF_HELPER_FLAGS_3(mve_vaddvuw, TCG_CALL_NO_WG, i32, env, ptr, i32);
+
+DEF_HELPER_FLAGS_3(mve_vaddlvs, TCG_CALL_NO_WG, i64, env, ptr, i64)
+DEF_HELPER_FLAGS_3(mve_vaddlvu, TCG_CALL_NO_WG, i64, env, ptr, i64)
+
+DEF_HELPER_FLAGS_4(mve_vabdsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vabdsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vabdsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vabdub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vabduh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vabduw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vfabds, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_3(mve_uqshl, TCG_CALL_NO_WG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(mve_sqshl, TCG_CALL_NO_WG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(mve_uqrshl, TCG_CALL_NO_WG, i32, env, i32, i32)
+DEF_HELPER_FLAGS_3(mve_sqrshr, TCG_CALL_NO_WG, i32, env, i32, i32)
+
+DEF_HELPER_FLAGS_3(mve_sshrl, TCG_CALL_NO_WG, i64, env, i64, i32)
+DEF_HELPER_FLAGS_3(mve_ushll, TCG_CALL_NO_WG, i64, env, i64, i32)
+DEF_HELPER_FLAGS_3(mve_sqshll, TCG_CALL_NO_WG, i64, env, i64, i32)
+DEF_HELPER_FLAGS_3(mve_uqshll, TCG_CALL_NO_WG, i64, env, i64, i32)
+
+DEF_HELPER_FLAGS_3(mve_sqrshrl, TCG_CALL_NO_WG, i64, env, i64, i32)
+DEF_HELPER_FLAGS_3(mve_uqrshll, TCG_CALL_NO_WG, i64, env, i64, i32)
+DEF_HELPER_FLAGS_3(mve_sqrshrl48, TCG_CALL_NO_WG, i64, env, i64, i32)
+DEF_HELPER_FLAGS_3(mve_uqrshll48, TCG_CALL_NO_WG, i64, env, i64, i32)
+
+DEF_HELPER_FLAGS_4(mve_vfmas, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr);
+DEF_HELPER_FLAGS_4(mve_vfmss, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr);
+
+DEF_HELPER_FLAGS_4(mve_vqdmladhb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmladhh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmladhw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmladhxb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmladhxh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmladhxw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqrdmladhb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmladhh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmladhw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmladhxb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmladhxh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmladhxw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqdmlsdhb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmlsdhh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmlsdhw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmlsdhxb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmlsdhxh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmlsdhxw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqrdmlsdhb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmlsdhh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmlsdhw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmlsdhxb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmlsdhxh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmlsdhxw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vsrib, TCG_CALL_NO_WG, void, env, ptr, ptr, i32);
+DEF_HELPER_FLAGS_4(mve_vsrih, TCG_CALL_NO_WG, void, env, ptr, ptr, i32);
+DEF_HELPER_FLAGS_4(mve_vsriw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32);
+
+DEF_HELPER_FLAGS_4(mve_vslib, TCG_CALL_NO_WG, void, env, ptr, ptr, i32);
+DEF_HELPER_FLAGS_4(mve_vslih, TCG_CALL_NO_WG, void, env, ptr, ptr, i32);
+DEF_HELPER_FLAGS_4(mve_vsliw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32);
+
+DEF_HELPER_FLAGS_4(mve_vmulhsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulhsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulhsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulhub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulhuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vmulhuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vrmulhsb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrmulhsh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrmulhsw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrmulhub, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrmulhuh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vrmulhuw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqdmullbh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmullbw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmullth, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmulltw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqdmullb_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmullb_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmullt_scalarh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmullt_scalarw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqdmulhb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmulhh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqdmulhw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqrdmulhb, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmulhh, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+DEF_HELPER_FLAGS_4(mve_vqrdmulhw, TCG_CALL_NO_WG, void, env, ptr, ptr, ptr)
+
+DEF_HELPER_FLAGS_4(mve_vqdmlahb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmlahh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmlahw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmlahb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmlahh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmlahw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqdmlashb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmlashh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqdmlashw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmlashb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmlashh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrdmlashw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqrshrnb_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrnb_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrnt_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrnt_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrnb_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrnb_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrnt_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrnt_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqrshrunbb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrunbh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshruntb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqrshrunth, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vstrb_sg_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrb_sg_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrb_sg_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrh_sg_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrh_sg_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrw_sg_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrd_sg_ud, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vstrh_sg_os_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrh_sg_os_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrw_sg_os_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrd_sg_os_ud, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vstrw_sg_wb_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vstrd_sg_wb_ud, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vldrb_sg_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrb_sg_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrh_sg_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrb_sg_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrb_sg_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrb_sg_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrh_sg_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrh_sg_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrw_sg_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrd_sg_ud, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vldrh_sg_os_sw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrh_sg_os_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrh_sg_os_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrw_sg_os_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrd_sg_os_ud, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vldrw_sg_wb_uw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vldrd_sg_wb_ud, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqshrnb_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrnb_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrnt_sb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrnt_sh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrnb_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrnb_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrnt_ub, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrnt_uh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vqshrunbb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshruntb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrunbh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vqshrunth, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vbrsrb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vbrsrh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vbrsrw, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vshlc, TCG_CALL_NO_WG, i32, env, ptr, i32, i32)
+
+DEF_HELPER_FLAGS_4(mve_vshrnbb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshrnbh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshrntb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vshrnth, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+
+DEF_HELPER_FLAGS_4(mve_vrshrnbb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrshrnbh, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrshrntb, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
+DEF_HELPER_FLAGS_4(mve_vrshrnth, TCG_CALL_NO_WG, void, env, ptr, ptr, i32)
 #endif
 
 #include "def-helper.h"
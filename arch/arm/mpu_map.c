@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Antmicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include "callbacks.h"
+#include "mpu_map.h"
+
+static int compare_bounds(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+//  No span starts or ends inside a segment, so it's enough to check the first address of it.
+static int32_t resolve_region(const mpu_map_span_t *spans, uint32_t spans_count, mpu_map_overlap_policy_t policy,
+                              uint32_t address)
+{
+    int32_t result = MPU_MAP_NO_REGION;
+
+    for(uint32_t i = 0; i < spans_count; i++) {
+        if(address < spans[i].start || address > spans[i].end || spans[i].region == result) {
+            continue;
+        }
+        if(result == MPU_MAP_NO_REGION) {
+            result = spans[i].region;
+        } else if(policy == MPU_MAP_HIGHEST_REGION_WINS) {
+            if(spans[i].region > result) {
+                result = spans[i].region;
+            }
+        } else {
+            return MPU_MAP_MULTIPLE_REGIONS;
+        }
+    }
+    return result;
+}
+
+void mpu_map_build(mpu_map_t *map, const mpu_map_span_t *spans, uint32_t spans_count, mpu_map_overlap_policy_t policy)
+{
+    uint32_t bounds_count = 0;
+    uint32_t *bounds = tlib_malloc(sizeof(uint32_t) * (2 * spans_count + 1));
+
+    bounds[bounds_count++] = 0;
+    for(uint32_t i = 0; i < spans_count; i++) {
+        bounds[bounds_count++] = spans[i].start;
+        if(spans[i].end != UINT32_MAX) {
+            bounds[bounds_count++] = spans[i].end + 1;
+        }
+    }
+    qsort(bounds, bounds_count, sizeof(bounds[0]), compare_bounds);
+
+    if(map->capacity < bounds_count) {
+        map->segments = tlib_realloc(map->segments, sizeof(mpu_map_segment_t) * bounds_count);
+        map->capacity = bounds_count;
+    }
+
+    map->count = 0;
+    for(uint32_t i = 0; i < bounds_count; i++) {
+        if(i > 0 && bounds[i] == bounds[i - 1]) {
+            continue;
+        }
+        int32_t region = resolve_region(spans, spans_count, policy, bounds[i]);
+
+        //  Merge neighbours with the same result, the border between them doesn't matter
+        if(map->count > 0 && map->segments[map->count - 1].region == region) {
+            continue;
+        }
+        map->segments[map->count].start = bounds[i];
+        map->segments[map->count].region = region;
+        map->count++;
+    }
+    map->valid = true;
+
+    tlib_free(bounds);
+}
+
+//  `covers_page` is set if the result is the same for the whole, aligned `page_size` block containing the address.
+int32_t mpu_map_lookup(const mpu_map_t *map, uint32_t address, uint32_t page_size, bool *covers_page)
+{
+    uint32_t low = 0;
+    uint32_t high = map->count - 1;
+
+    //  The first segment always starts at 0
+    while(low < high) {
+        uint32_t mid = (low + high + 1) / 2;
+        if(map->segments[mid].start <= address) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    if(covers_page != NULL) {
+        uint32_t page_start = address & ~(page_size - 1);
+        uint32_t page_end = page_start + (page_size - 1);
+        bool ends_after_page = low + 1 == map->count || map->segments[low + 1].start > page_end;
+
+        *covers_page = map->segments[low].start <= page_start && ends_after_page;
+    }
+    return map->segments[low].region;
+}
+
+void mpu_map_free(mpu_map_t *map)
+{
+    tlib_free(map->segments);
+    map->segments = NULL;
+    map->count = 0;
+    map->capacity = 0;
+    map->valid = false;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Antmicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//  Flattened view of a set of (possibly overlapping) MPU, SAU or IDAU regions.
+//  The address space is split into sorted segments, each holding the lookup result
+//  for all of its addresses, so a lookup is a binary search and a page can be cached
+//  as a whole if it fits in a single segment.
+
+#define MPU_MAP_NO_REGION        -1
+#define MPU_MAP_MULTIPLE_REGIONS -2
+
+typedef struct {
+    uint32_t start;
+    int32_t region;
+} mpu_map_segment_t;
+
+typedef struct {
+    mpu_map_segment_t *segments;
+    uint32_t count;
+    uint32_t capacity;
+    bool valid;
+} mpu_map_t;
+
+//  Address range, inclusive on both ends, belonging to the given region.
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+    int32_t region;
+} mpu_map_span_t;
+
+typedef enum {
+    //  PMSAv7: the region with the highest number takes precedence
+    MPU_MAP_HIGHEST_REGION_WINS,
+    //  PMSAv8, SAU and IDAU: an address matching more than one region resolves to `MPU_MAP_MULTIPLE_REGIONS`
+    MPU_MAP_OVERLAP_IS_MULTIPLE,
+} mpu_map_overlap_policy_t;
+
+void mpu_map_build(mpu_map_t *map, const mpu_map_span_t *spans, uint32_t spans_count, mpu_map_overlap_policy_t policy);
+int32_t mpu_map_lookup(const mpu_map_t *map, uint32_t address, uint32_t page_size, bool *covers_page);
+void mpu_map_free(mpu_map_t *map);
+
+static inline void mpu_map_invalidate(mpu_map_t *map)
+{
+    map->valid = false;
+}
@@ -379,6 +379,7 @@ static inline void set_c6_drbar(CPUState *env, uint64_t val)
         tlib_abortf("Region size smaller than 32 bytes is not supported. Region base address must be divisible by 32");
     }
     env->cp15.c6_base_address[env->cp15.c6_region_number] = val;
+    arm_invalidate_region_maps(env);
     tlb_flush(env, 1, false);
 }
 RW_FUNCTIONS(64, c6_drbar, get_c6_drbar(env), set_c6_drbar(env, value))
@@ -395,6 +396,7 @@ static inline void set_c6_drsr(CPUState *env, uint64_t val)
 
     env->cp15.c6_size_and_enable[index] = val & MPU_SIZE_AND_ENABLE_FIELD_MASK;
     env->cp15.c6_subregion_disable[index] = (val & MPU_SUBREGION_DISABLE_FIELD_MASK) >> MPU_SUBREGION_DISABLE_FIELD_OFFSET;
+    arm_invalidate_region_maps(env);
     tlb_flush(env, 1, false);
 }
 RW_FUNCTIONS(64, c6_drsr, get_c6_drsr(env), set_c6_drsr(env, value))
@@ -4339,7 +4339,7 @@ static inline void gen_goto_tb(DisasContext *s, int n, uint32_t dest)
         gen_exit_tb(tb, n);
     } else {
         gen_set_pc_im(dest);
-        gen_exit_tb_no_chaining(tb);
+        gen_lookup_and_goto_ptr(tb);
     }
 }
 
@@ -16605,8 +16605,11 @@ uint32_t gen_intermediate_code_epilogue(CPUState *env, DisasContextBase *base)
         case DISAS_NEXT:
             gen_goto_tb(dc, 1, dc->base.pc);
             break;
-        default:
         case DISAS_JUMP:
+            /* look up the next TB without going back to the main loop */
+            gen_lookup_and_goto_ptr(dc->base.tb);
+            break;
+        default:
         case DISAS_UPDATE:
             /* indicate that the hash table must be used to find the next TB */
             gen_exit_tb_no_chaining(dc->base.tb);
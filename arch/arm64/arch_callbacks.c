@@ -24,3 +24,5 @@ DEFAULT_VOID_HANDLER4(void tlib_on_tcm_mapping_update, int32_t index, uint64_t n
                       uint32_t el2_enabled)
 
 DEFAULT_INT_HANDLER1(uint64_t tlib_get_random_ulong, void)
+
+DEFAULT_PTR_HANDLER1(void *tlib_guest_offset_to_allocation_tags, uint64_t offset)
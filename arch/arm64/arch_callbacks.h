@@ -23,3 +23,7 @@ void tlib_handle_psci_call(void);
 void tlib_on_tcm_mapping_update(int32_t index, uint64_t new_address, uint32_t el01_enabled, uint32_t el2_enabled);
 
 uint64_t tlib_get_random_ulong(void);
+
+//  MTE allocation tags of the guest RAM at 'offset', two 4-bit tags per byte, lower address in the lower nibble.
+//  The storage has to be zero-initialized and shared by all cores. NULL makes each core keep its own tags.
+void *tlib_guest_offset_to_allocation_tags(uint64_t offset);
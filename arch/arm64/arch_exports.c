@@ -175,3 +175,17 @@ void tlib_set_rndr_supported(uint32_t rndr)
 }
 
 EXC_VOID_1(tlib_set_rndr_supported, uint32_t, rndr)
+
+//  0 - no MTE, 1 - FEAT_MTE (tag instructions only), 2 - FEAT_MTE2 (tag checks), 3 - FEAT_MTE3.
+//  Tags are only shared between cores if 'tlib_guest_offset_to_allocation_tags' provides their storage.
+void tlib_set_mte_supported(uint32_t mte)
+{
+    if(mte > 3 || (mte != 0 && !arm_feature(env, ARM_FEATURE_AARCH64))) {
+        tlib_abortf("Unable to set MTE support to %d for this core", mte);
+    }
+
+    env->arm_core_config.isar.id_aa64pfr1 = FIELD_DP64(env->arm_core_config.isar.id_aa64pfr1, ID_AA64PFR1, MTE, mte);
+    arm_rebuild_hflags(env);
+}
+
+EXC_VOID_1(tlib_set_mte_supported, uint32_t, mte)
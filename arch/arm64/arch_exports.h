@@ -17,3 +17,4 @@ void tlib_set_current_el(uint32_t el);
 void tlib_set_mpu_regions_count(uint32_t count);
 void tlib_psci_handler_enable(uint32_t mode);
 void tlib_set_gic_cpu_register_interface_version(uint32_t iface_version);
+void tlib_set_mte_supported(uint32_t mte);
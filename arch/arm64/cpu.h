@@ -404,6 +404,14 @@ typedef struct pmsav8_region {
     uint64_t overlapping_regions_mask;
 } pmsav8_region;
 
+//  Number of buckets of the MTE allocation tag page hash, see 'mte_helper.c'.
+#define MTE_TAG_PAGES_HASH_SIZE 1024
+
+//  TLB attribute bit of entries filled from Tagged Normal memory, see 'tlb_set_page_with_attrs'.
+#define ARM_TLB_ATTR_MTE_TAGGED 1
+
+struct MTETagPage;
+
 typedef struct CPUState {
     /* Regs for current mode.  */
     uint32_t regs[16];
@@ -951,6 +959,14 @@ typedef struct CPUState {
     CPU_COMMON
 
     TTable *cp_regs;
+
+    //  MTE allocation tags, kept outside of the reset area.
+    struct {
+        //  Set by the translation table walk if the final descriptor maps Tagged Normal memory.
+        bool walk_tagged;
+        //  Tag storage of the RAM pages used so far, hashed by their guest offset.
+        struct MTETagPage *tag_pages[MTE_TAG_PAGES_HASH_SIZE];
+    } mte;
 } CPUState;
 
 static inline void set_feature(CPUARMState *env, int feature)
@@ -2777,6 +2793,15 @@ FIELD(TBFLAG_A64, SVL, 24, 4)
 /* Indicates that SME Streaming mode is active, and SMCR_ELx.FA64 is not. */
 FIELD(TBFLAG_A64, SME_TRAP_NONSTREAMING, 28, 1)
 
+/*
+ * Descriptor passed from the translator to the MTE check helpers.
+ */
+FIELD(MTEDESC, MIDX, 0, 4)
+FIELD(MTEDESC, TBI, 4, 2)
+FIELD(MTEDESC, TCMA, 6, 2)
+FIELD(MTEDESC, WRITE, 8, 1)
+FIELD(MTEDESC, SIZEM1, 9, 13)
+
 #undef FIELD
 
 /*
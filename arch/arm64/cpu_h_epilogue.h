@@ -119,8 +119,20 @@ enum PMSAv8_FAULT_TYPE {
 #define FLOAT_TO_INT_FUNC(from_type, to_type)                                                               \
     static inline to_type from_type##_to_##to_type##_scalbn(from_type a, int rmode, int scale STATUS_PARAM) \
     {                                                                                                       \
+        int old_rmode = get_float_rounding_mode(status);                                                    \
         from_type scaled = from_type##_scalbn(a, scale STATUS_VAR);                                         \
-        return from_type##_to_##to_type(scaled STATUS_VAR);                                                 \
+        set_float_rounding_mode(rmode STATUS_VAR);                                                          \
+        to_type result = from_type##_to_##to_type(scaled STATUS_VAR);                                       \
+        set_float_rounding_mode(old_rmode STATUS_VAR);                                                      \
+        return result;                                                                                      \
+    }
+
+//  Scaling a half-precision value can leave its range, so it's widened to a double first where any scale is exact.
+#define FLOAT16_TO_INT_FUNC(to_type)                                                                  \
+    static inline to_type float16_to_##to_type##_scalbn(float16 a, int rmode, int scale STATUS_PARAM) \
+    {                                                                                                 \
+        float64 wide = float16_to_float64(float16_squash_input_denormal(a STATUS_VAR), 1 STATUS_VAR); \
+        return float64_to_##to_type##_scalbn(wide, rmode, scale STATUS_VAR);                          \
     }
 
 #define INT_TO_FLOAT_FUNC(from_type, to_type)                                                    \
@@ -138,6 +150,17 @@ FLOAT_TO_INT_FUNC(float64, int32)
 FLOAT_TO_INT_FUNC(float64, uint32)
 FLOAT_TO_INT_FUNC(float32, int64)
 FLOAT_TO_INT_FUNC(float32, uint64)
+FLOAT_TO_INT_FUNC(float64, int16)
+FLOAT_TO_INT_FUNC(float64, uint16)
+FLOAT_TO_INT_FUNC(float32, int16)
+FLOAT_TO_INT_FUNC(float32, uint16)
+
+FLOAT16_TO_INT_FUNC(int16)
+FLOAT16_TO_INT_FUNC(uint16)
+FLOAT16_TO_INT_FUNC(int32)
+FLOAT16_TO_INT_FUNC(uint32)
+FLOAT16_TO_INT_FUNC(int64)
+FLOAT16_TO_INT_FUNC(uint64)
 
 INT_TO_FLOAT_FUNC(int64, float64)
 INT_TO_FLOAT_FUNC(int64, float32)
@@ -147,6 +170,10 @@ INT_TO_FLOAT_FUNC(int32, float64)
 INT_TO_FLOAT_FUNC(int32, float32)
 INT_TO_FLOAT_FUNC(uint32, float64)
 INT_TO_FLOAT_FUNC(uint32, float32)
+INT_TO_FLOAT_FUNC(int16, float64)
+INT_TO_FLOAT_FUNC(int16, float32)
+INT_TO_FLOAT_FUNC(uint16, float64)
+INT_TO_FLOAT_FUNC(uint16, float32)
 
 //  Provide missing prototypes.
 int arm_rmode_to_sf(int rmode);
@@ -154,6 +181,7 @@ int bank_number(int mode);
 int exception_target_el(CPUARMState *env);
 uint64_t mte_check(CPUARMState *env, uint32_t desc, uint64_t ptr, uintptr_t ra);
 bool mte_probe(CPUARMState *env, uint32_t desc, uint64_t ptr);
+void mte_free_tag_storage(CPUARMState *env);
 void raise_exception_without_block_end_hooks(CPUARMState *env, uint32_t excp, uint32_t syndrome, uint32_t target_el);
 void raise_exception(CPUARMState *env, uint32_t excp, uint32_t syndrome, uint32_t target_el);
 void raise_exception_ra(CPUARMState *env, uint32_t excp, uint32_t syndrome, uint32_t target_el, uintptr_t ra);
@@ -469,6 +497,41 @@ static inline bool regime_has_2_ranges(ARMMMUIdx idx)
     }
 }
 
+//  MTE allocation tags cover 16-byte granules of Tagged Normal memory.
+#define LOG2_TAG_GRANULE 4
+#define TAG_GRANULE      (1 << LOG2_TAG_GRANULE)
+
+static inline int allocation_tag_from_addr(uint64_t ptr)
+{
+    return extract64(ptr, 56, 4);
+}
+
+static inline uint64_t address_with_allocation_tag(uint64_t ptr, int rtag)
+{
+    return deposit64(ptr, 56, 4, rtag);
+}
+
+//  Return true if the MTEDESC TBI bits make an access to the 'bit55' half of the address space checked.
+static inline bool tbi_check(uint32_t desc, int bit55)
+{
+    return (FIELD_EX32(desc, MTEDESC, TBI) >> bit55) & 1;
+}
+
+//  Return true if the access is unchecked because of TCMA and a match-all logical tag.
+static inline bool tcma_check(uint32_t desc, int bit55, int ptr_tag)
+{
+    //  Fold (ptr<59:55> == 00000 || ptr<59:55> == 11111) into a single test.
+    bool match = ((ptr_tag + bit55) & 0xf) == 0;
+    bool tcma = (FIELD_EX32(desc, MTEDESC, TCMA) >> bit55) & 1;
+    return tcma && match;
+}
+
+//  Only user-mode emulation strips the tag from addresses passed to the softmmu.
+static inline uint64_t useronly_clean_ptr(uint64_t ptr)
+{
+    return ptr;
+}
+
 static inline void set_el_features(CPUState *env, bool el2_enabled, bool el3_enabled)
 {
     env->features = deposit64(env->features, ARM_FEATURE_EL2, 1, el2_enabled);
@@ -480,11 +543,10 @@ static inline uint32_t tb_cflags(TranslationBlock *tb)
     return tb->cflags;
 }
 
-//  TODO: Port 'tcg_gen_lookup_and_goto_ptr' for more efficient jumps?
-//        The upstream function has no arguments.
+//  The upstream function has no arguments, the TB is needed for the block finished hook.
 static inline void tcg_gen_lookup_and_goto_ptr(DisasContext *dc)
 {
-    gen_exit_tb_no_chaining(dc->base.tb);
+    gen_lookup_and_goto_ptr(dc->base.tb);
 }
 
 static inline ARMMMUIdx el_to_arm_mmu_idx(CPUState *env, int el)
@@ -949,6 +949,14 @@ void HELPER(dc_zva)(CPUARMState *env, uint64_t vaddr_in)
     int prot;
     target_ulong page_size;
 
+    //  The block is aligned and never larger than a page, so it can't cross one.
+    void *host = probe_write(env, vaddr, blocklen, mmu_idx, ARM_GETPC());
+    if(likely(host != NULL)) {
+        memset(host, 0, blocklen);
+        return;
+    }
+
+    //  Slow path for MMIO, pages which have to be checked on each access and pages with translated code.
     if(get_phys_addr(env, vaddr, ACCESS_DATA_STORE, mmu_idx, ARM_GETPC(), false, &phys_addr, &prot, &page_size, blocklen) !=
        TRANSLATE_SUCCESS) {
         tlib_printf(LOG_LEVEL_DEBUG, "Incorrect virtual address in DC ZVA: 0x%" PRIx64, vaddr_in);
@@ -960,6 +968,20 @@ void HELPER(dc_zva)(CPUARMState *env, uint64_t vaddr_in)
     free(buf);
 }
 
+static bool allocation_tag_access_enabled(CPUARMState *env, int el, uint64_t sctlr)
+{
+    if(el < 3 && arm_feature(env, ARM_FEATURE_EL3) && !(env->cp15.scr_el3 & SCR_ATA)) {
+        return false;
+    }
+    if(el < 2 && arm_is_el2_enabled(env)) {
+        uint64_t hcr = arm_hcr_el2_eff(env);
+        if(!(hcr & HCR_ATA) && (!(hcr & HCR_E2H) || !(hcr & HCR_TGE))) {
+            return false;
+        }
+    }
+    return (sctlr & (el == 0 ? SCTLR_ATA0 : SCTLR_ATA)) != 0;
+}
+
 //  TODO: Move to a separate file with our license header.
 void HELPER(rebuild_hflags_a64)(CPUARMState *env, int el)
 {
@@ -987,14 +1009,14 @@ void HELPER(rebuild_hflags_a64)(CPUARMState *env, int el)
     DP_TBFLAG_ANY(env->hflags, ALIGN_MEM, sctlr & SCTLR_A);
     DP_TBFLAG_ANY(env->hflags, PSTATE__IL, env->pstate & PSTATE_IL);
 
-    uint8_t tbii = 0;
+    uint8_t tbi = 0;
     if(regime_has_2_ranges(mmuidx)) {
-        tbii = extract64(tcr, 37, 2);
+        tbi = extract64(tcr, 37, 2);
     } else {
         //  Two bits are expected from single-range regimes too.
-        tbii = extract64(tcr, 20, 1) ? 0b11 : 0;
+        tbi = extract64(tcr, 20, 1) ? 0b11 : 0;
     }
-    DP_TBFLAG_A64(env->hflags, TBII, tbii);
+    DP_TBFLAG_A64(env->hflags, TBII, tbi);
 
     //  TODO: get correct EL, for now always 3
     DP_TBFLAG_A64(env->hflags, SVEEXC_EL, 3);
@@ -1019,17 +1041,8 @@ void HELPER(rebuild_hflags_a64)(CPUARMState *env, int el)
     }
     DP_TBFLAG_A64(env->hflags, BT, bt);
 
-    uint8_t tbid = 0;
-    //  TBID requires ARMv8.3-PAuth feature.
-    if(isar_feature_aa64_pauth(isar)) {
-        if(regime_has_2_ranges(mmuidx)) {
-            tbid = extract64(tcr, 50, 2);
-        } else {
-            //  Two bits are expected from single-range regimes too.
-            tbid = extract64(tcr, 29, 1) ? 0b11 : 0;
-        }
-    }
-    DP_TBFLAG_A64(env->hflags, TBID, tbid);
+    //  TBID caches the data TBI bits, it's only used to build MTE check descriptors.
+    DP_TBFLAG_A64(env->hflags, TBID, tbi);
 
     //  D1.1
     if(el != 0) {
@@ -1037,43 +1050,38 @@ void HELPER(rebuild_hflags_a64)(CPUARMState *env, int el)
     } else {
         DP_TBFLAG_A64(env->hflags, UNPRIV, 1);
     }
-    //  ATA - allocation tag access
-    uint8_t ata = 0;
-    switch(el) {
-        case 3:
-            ata = extract64(sctlr, 43, 2);
-            break;
-        case 2:
-        case 1:
-            ata = extract64(sctlr, 42, 2);
-            break;
-        case 0:
-            break;
-        default:
-            tlib_abortf("Unreachable: %d", el);
-    }
-    DP_TBFLAG_A64(env->hflags, ATA, ata);
-    uint8_t tcma = 0;
-    switch(el) {
-        case 3:
-        case 2:
-            tcma = extract64(env->cp15.tcr_el[el], 30, 1);
-            break;
-        case 1:
-            tcma = extract64(env->cp15.tcr_el[el], 57, 2);
-            break;
-        case 0:
-            break;
-        default:
-            tlib_abortf("Unreachable: %d", el);
-    }
-    DP_TBFLAG_A64(env->hflags, TCMA, tcma);
-    //  TODO: assume not active
-    //  get correct value after implementation of 'ID_AA64PFR1_EL1' register
+    //  ATA - allocation tag access, MTE_ACTIVE - some accesses may be Checked.
+    //  MTE_ACTIVE stays clear if all accesses are Unchecked:
+    //  1) there are no tags in the address without TBI,
+    //  2) Tag Check Override makes all accesses Unchecked,
+    //  3) Checked accesses have no effect with Tag Check Fail == 0,
+    //  4) all accesses are Unchecked without Allocation Tag Access.
+    DP_TBFLAG_A64(env->hflags, ATA, 0);
     DP_TBFLAG_A64(env->hflags, MTE_ACTIVE, 0);
-    //  TODO: assume not active
-    //  unprivileged access?
     DP_TBFLAG_A64(env->hflags, MTE0_ACTIVE, 0);
+    DP_TBFLAG_A64(env->hflags, TCMA, 0);
+    if(isar_feature_aa64_mte(isar)) {
+        bool tco = env->pstate & PSTATE_TCO;
+        if(allocation_tag_access_enabled(env, el, sctlr)) {
+            DP_TBFLAG_A64(env->hflags, ATA, 1);
+            if(tbi && !tco && (sctlr & (el == 0 ? SCTLR_TCF0 : SCTLR_TCF))) {
+                DP_TBFLAG_A64(env->hflags, MTE_ACTIVE, 1);
+            }
+        }
+        //  And again for the unprivileged (LDTR/STTR) accesses.
+        if(el != 0 && tbi && !tco && (sctlr & SCTLR_TCF0) && allocation_tag_access_enabled(env, 0, sctlr)) {
+            DP_TBFLAG_A64(env->hflags, MTE0_ACTIVE, 1);
+        }
+
+        uint8_t tcma = 0;
+        if(regime_has_2_ranges(mmuidx)) {
+            tcma = extract64(tcr, 57, 2);
+        } else {
+            //  Two bits are expected from single-range regimes too.
+            tcma = extract64(tcr, 30, 1) ? 0b11 : 0;
+        }
+        DP_TBFLAG_A64(env->hflags, TCMA, tcma);
+    }
     //  TODO: get correct EL, for now always 3
     DP_TBFLAG_A64(env->hflags, SMEEXC_EL, 3);
     //  TODO: get correct value after implementation of 'SVCR' register
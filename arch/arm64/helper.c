@@ -99,6 +99,7 @@ int process_interrupt(int interrupt_request, CPUState *env)
 void tlib_arch_dispose()
 {
     ttable_remove(cpu->cp_regs);
+    mte_free_tag_storage(cpu);
 }
 
 /* CPU initialization and reset. */
@@ -690,7 +691,11 @@ void do_interrupt_a64(CPUState *env)
     //  set new exception level and 'PSTATE.SP' field
     uint32_t new_pstate = aarch64_pstate_mode(target_el, true);
     //  set DAIF bits
-    new_pstate |= PSTATE_DAIF;  //  TODO: Set also TCO bit after adding support for ARMv8.5-MTE
+    new_pstate |= PSTATE_DAIF;
+    //  Tag checks stay disabled on exception entry until the handler clears TCO.
+    if(isar_feature_aa64_mte(&env->arm_core_config.isar)) {
+        new_pstate |= PSTATE_TCO;
+    }
     //  set PSTATE.SSBS to value of SCTLR.DSSBS
     new_pstate |= (!!(arm_sctlr(env, target_el) & SCTLR_DSSBS_64) << 12);
 
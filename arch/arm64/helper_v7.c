@@ -672,6 +672,9 @@ int get_phys_addr_pmsav8(CPUState *env, target_ulong address, int access_type, u
 inline int get_phys_addr(CPUState *env, target_ulong address, int access_type, int mmu_idx, uintptr_t return_address,
                          bool suppress_faults, target_ulong *phys_ptr, int *prot, target_ulong *page_size, int access_width)
 {
+    //  Only the v8 translation table walk can map Tagged Normal memory.
+    env->mte.walk_tagged = false;
+
     if(!arm_feature(env, ARM_FEATURE_V8)) {
         return get_phys_addr_v7(env, address, access_type, mmu_idx, phys_ptr, prot, page_size, suppress_faults);
     }
@@ -743,7 +746,8 @@ int cpu_handle_mmu_fault(CPUState *env, target_ulong address, int access_type, i
         /* Map a single [sub]page.  */
         phys_addr &= TARGET_PAGE_MASK;
         address &= TARGET_PAGE_MASK;
-        tlb_set_page(env, address, phys_addr, prot, mmu_idx, page_size);
+        tlb_set_page_with_attrs(env, address, phys_addr, prot, mmu_idx, page_size,
+                                env->mte.walk_tagged ? ARM_TLB_ATTR_MTE_TAGGED : 0);
     }
     return ret;
 }
@@ -510,6 +510,9 @@ int get_phys_addr_v8(CPUState *env, target_ulong address, int access_type, int m
     }
 
 success:
+    //  MAIR attribute 0xF0 denotes Tagged Normal memory (FEAT_MTE2).
+    env->mte.walk_tagged =
+        extract64(env->cp15.mair_el[address_translation_el(env, current_el)], extract64(desc, 2, 3) * 8, 8) == 0xf0;
     parse_desc(MMU_GET_XLAT_VA_SIZE_SHIFT(level, page_size_shift), desc, ips, address, current_el == 0, phys_ptr, prot,
                page_size);
     if(is_page_access_valid(*prot, access_type)) {
@@ -43,6 +43,116 @@ static int choose_nonexcluded_tag(int tag, int offset, uint16_t exclude)
     return tag;
 }
 
+/*
+ * Allocation tag storage.
+ *
+ * Tags hold one 4-bit tag per 16-byte granule, i.e. TARGET_PAGE_SIZE / 32
+ * bytes for each page, and are keyed by the guest RAM offset of the page so
+ * all virtual aliases of a physical page share them.  Each core is a
+ * separate library instance, so the storage itself is provided by the host
+ * through 'tlib_guest_offset_to_allocation_tags', usually allocated next to
+ * the guest RAM.  The pointers are cached per core in 'env->mte.tag_pages'.
+ *
+ * Without host storage the tags are allocated here on the first tag store,
+ * which is only correct as long as no other core accesses the same memory.
+ * Tags of a page that has never been written read as zero then.
+ *
+ * Whether a page is Tagged Normal memory is decided by the translation table
+ * walk and kept in the TLB attributes as ARM_TLB_ATTR_MTE_TAGGED.
+ */
+#define MTE_TAG_BYTES_PER_PAGE (TARGET_PAGE_SIZE >> (LOG2_TAG_GRANULE + 1))
+
+typedef struct MTETagPage {
+    uint64_t ram_page;
+    struct MTETagPage *next;
+    uint8_t *tags;
+    //  Allocated here because the host provides no tag storage.
+    bool local;
+} MTETagPage;
+
+static uint8_t zero_tags[MTE_TAG_BYTES_PER_PAGE];
+
+static uint8_t *mte_tag_page(CPUARMState *env, uint64_t ram_page, bool allocate)
+{
+    static bool local_storage_reported;
+    MTETagPage **bucket = &env->mte.tag_pages[(ram_page >> TARGET_PAGE_BITS) & (MTE_TAG_PAGES_HASH_SIZE - 1)];
+    MTETagPage *page;
+    uint8_t *tags;
+
+    for(page = *bucket; page != NULL; page = page->next) {
+        if(page->ram_page == ram_page) {
+            return page->tags;
+        }
+    }
+
+    tags = tlib_guest_offset_to_allocation_tags(ram_page);
+    if(tags == NULL) {
+        if(!allocate) {
+            return zero_tags;
+        }
+        if(!local_storage_reported) {
+            tlib_printf(LOG_LEVEL_WARNING, "MTE: no allocation tag storage provided, tags won't be shared with other cores");
+            local_storage_reported = true;
+        }
+    }
+
+    page = tlib_mallocz(sizeof(MTETagPage));
+    page->ram_page = ram_page;
+    page->local = tags == NULL;
+    page->tags = page->local ? tlib_mallocz(MTE_TAG_BYTES_PER_PAGE) : tags;
+    page->next = *bucket;
+    *bucket = page;
+    return page->tags;
+}
+
+void mte_free_tag_storage(CPUARMState *env)
+{
+    int i;
+    for(i = 0; i < MTE_TAG_PAGES_HASH_SIZE; i++) {
+        MTETagPage *page = env->mte.tag_pages[i];
+        while(page != NULL) {
+            MTETagPage *next = page->next;
+            if(page->local) {
+                tlib_free(page->tags);
+            }
+            tlib_free(page);
+            page = next;
+        }
+        env->mte.tag_pages[i] = NULL;
+    }
+}
+
+static inline bool mte_tlb_tagged(CPUARMState *env, int mmu_idx, uint64_t ptr)
+{
+    int index = (ptr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    return env->tlb_attrs[mmu_idx][index] == ((ptr & TARGET_PAGE_MASK) | ARM_TLB_ATTR_MTE_TAGGED);
+}
+
+//  Guest RAM offset of the page mapped by the TLB entry of @ptr, the entry has to be valid.
+static inline uint64_t mte_tlb_ram_page(CPUARMState *env, int mmu_idx, uint64_t ptr)
+{
+    int index = (ptr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    return (env->iotlb[mmu_idx][index] + (ptr & TARGET_PAGE_MASK)) & TARGET_PAGE_MASK;
+}
+
+/*
+ * Resolve @ptr in the softmmu TLB, raising an exception for inaccessible
+ * pages unless @ra is 0.  Return the host address or NULL if the page is
+ * not plain RAM.
+ */
+static void *mte_probe_host(CPUARMState *env, uint64_t ptr, int access_type, int mmu_idx, uintptr_t ra)
+{
+    void *host = tlb_vaddr_to_host(env, ptr, access_type, mmu_idx);
+
+    if(host == NULL) {
+        if(tlb_fill(env, ptr, access_type, mmu_idx, (void *)ra, ra == 0, 1) != TRANSLATE_SUCCESS) {
+            return NULL;
+        }
+        host = tlb_vaddr_to_host(env, ptr, access_type, mmu_idx);
+    }
+    return host;
+}
+
 /**
  * allocation_tag_mem:
  * @env: the cpu environment
@@ -59,9 +169,9 @@ static int choose_nonexcluded_tag(int tag, int offset, uint16_t exclude)
  * tags, with the tag at [3:0] for the lower addr and the tag at [7:4]
  * for the higher addr.
  *
- * Here, resolve the physical address from the virtual address, and return
- * a pointer to the corresponding tag byte.  Exit with exception if the
- * virtual address is not accessible for @ptr_access.
+ * Here, resolve the virtual address in the TLB, and return a pointer to
+ * the corresponding tag byte.  Exit with exception if the virtual address
+ * is not accessible for @ptr_access.
  *
  * The @ptr_size and @tag_size values may not have an obvious relation
  * due to the alignment of @ptr, and the number of tag checks required.
@@ -71,14 +181,11 @@ static int choose_nonexcluded_tag(int tag, int offset, uint16_t exclude)
 static uint8_t *allocation_tag_mem(CPUARMState *env, int ptr_mmu_idx, uint64_t ptr, MMUAccessType ptr_access, int ptr_size,
                                    MMUAccessType tag_access, int tag_size, uintptr_t ra)
 {
-    uintptr_t index;
-    CPUIOTLBEntry *iotlbentry;
-    int in_page, flags;
-    ram_addr_t ptr_ra;
-    hwaddr ptr_paddr, tag_paddr, xlat;
-    MemoryRegion *mr;
-    ARMASIdx tag_asi;
-    AddressSpace *tag_as;
+    //  Beware, MMUAccessType values differ from the ACCESS_* ones used by the TLB.
+    int access_type = ptr_access == MMU_DATA_STORE ? ACCESS_DATA_STORE : ACCESS_DATA_LOAD;
+    uintptr_t offset = ptr & ~TARGET_PAGE_MASK;
+    uintptr_t tag_offset;
+    int in_page;
     void *host;
 
     /*
@@ -87,30 +194,12 @@ static uint8_t *allocation_tag_mem(CPUARMState *env, int ptr_mmu_idx, uint64_t p
      * into the softmmu tlb.
      *
      * When RA == 0, this is for mte_probe.  The page is expected to be
-     * valid.  Indicate to probe_access_flags no-fault, then assert that
-     * we received a valid page.
+     * valid, so don't raise any fault.
      */
-    flags = probe_access_flags(env, ptr, ptr_access, ptr_mmu_idx, ra == 0, &host, ra);
-    tlib_assert(!(flags & TLB_INVALID_MASK));
-
-    /*
-     * Find the iotlbentry for ptr.  This *must* be present in the TLB
-     * because we just found the mapping.
-     * TODO: Perhaps there should be a cputlb helper that returns a
-     * matching tlb entry + iotlb entry.
-     */
-    index = tlb_index(env, ptr_mmu_idx, ptr);
-#ifdef DEBUG
-    {
-        CPUTLBEntry *entry = tlb_entry(env, ptr_mmu_idx, ptr);
-        target_ulong comparator = (ptr_access == MMU_DATA_LOAD ? entry->addr_read : entry->addr_write);
-        tlib_assert(tlb_hit(comparator, ptr));
-    }
-#endif
-    iotlbentry = &env_tlb(env)->d[ptr_mmu_idx].iotlb[index];
+    host = mte_probe_host(env, ptr, access_type, ptr_mmu_idx, ra);
 
     /* If the virtual page MemAttr != Tagged, access unchecked. */
-    if(!arm_tlb_mte_tagged(&iotlbentry->attrs)) {
+    if(!mte_tlb_tagged(env, ptr_mmu_idx, ptr)) {
         return NULL;
     }
 
@@ -118,7 +207,7 @@ static uint8_t *allocation_tag_mem(CPUARMState *env, int ptr_mmu_idx, uint64_t p
      * If not backed by host ram, there is no tag storage: access unchecked.
      * This is probably a guest os bug though, so log it.
      */
-    if(unlikely(flags & TLB_MMIO)) {
+    if(unlikely(host == NULL)) {
         tlib_printf(LOG_LEVEL_ERROR,
                     "Page @ 0x%" PRIx64 " indicates Tagged Normal memory "
                     "but is not backed by host ram",
@@ -134,64 +223,13 @@ static uint8_t *allocation_tag_mem(CPUARMState *env, int ptr_mmu_idx, uint64_t p
      */
     in_page = -(ptr | TARGET_PAGE_MASK);
     if(unlikely(ptr_size > in_page)) {
-        void *ignore;
-        flags |= probe_access_flags(env, ptr + in_page, ptr_access, ptr_mmu_idx, ra == 0, &ignore, ra);
-        tlib_assert(!(flags & TLB_INVALID_MASK));
+        mte_probe_host(env, ptr + in_page, access_type, ptr_mmu_idx, ra);
     }
 
-    /* Any debug exception has priority over a tag check exception. */
-    if(unlikely(flags & TLB_WATCHPOINT)) {
-        int wp = ptr_access == MMU_DATA_LOAD ? BP_MEM_READ : BP_MEM_WRITE;
-        tlib_assert(ra != 0);
-        cpu_check_watchpoint(env_cpu(env), ptr, ptr_size, iotlbentry->attrs, wp, ra);
-    }
-
-    /*
-     * Find the physical address within the normal mem space.
-     * The memory region lookup must succeed because TLB_MMIO was
-     * not set in the cputlb lookup above.
-     */
-    mr = memory_region_from_host(host, &ptr_ra);
-    tcg_debug_assert(mr != NULL);
-    tcg_debug_assert(memory_region_is_ram(mr));
-    ptr_paddr = ptr_ra;
-    do {
-        ptr_paddr += mr->addr;
-        mr = mr->container;
-    } while(mr);
-
-    /* Convert to the physical address in tag space.  */
-    tag_paddr = ptr_paddr >> (LOG2_TAG_GRANULE + 1);
-
-    /* Look up the address in tag space. */
-    tag_asi = iotlbentry->attrs.secure ? ARMASIdx_TagS : ARMASIdx_TagNS;
-    tag_as = cpu_get_address_space(env_cpu(env), tag_asi);
-    mr = address_space_translate(tag_as, tag_paddr, &xlat, NULL, tag_access == MMU_DATA_STORE, iotlbentry->attrs);
+    tag_offset = offset >> (LOG2_TAG_GRANULE + 1);
+    tlib_assert(tag_offset + tag_size <= MTE_TAG_BYTES_PER_PAGE);
 
-    /*
-     * Note that @mr will never be NULL.  If there is nothing in the address
-     * space at @tag_paddr, the translation will return the unallocated memory
-     * region.  For our purposes, the result must be ram.
-     */
-    if(unlikely(!memory_region_is_ram(mr))) {
-        /* ??? Failure is a board configuration error. */
-        tlib_printf(LOG_LEVEL_WARNING,
-                    "Tag Memory @ 0x%" HWADDR_PRIx " not found for "
-                    "Normal Memory @ 0x%" HWADDR_PRIx,
-                    tag_paddr, ptr_paddr);
-        return NULL;
-    }
-
-    /*
-     * Ensure the tag memory is dirty on write, for migration.
-     * Tag memory can never contain code or display memory (vga).
-     */
-    if(tag_access == MMU_DATA_STORE) {
-        ram_addr_t tag_ra = memory_region_get_ram_addr(mr) + xlat;
-        cpu_physical_memory_set_dirty_flag(tag_ra, DIRTY_MEMORY_MIGRATION);
-    }
-
-    return memory_region_get_ram_ptr(mr) + xlat;
+    return mte_tag_page(env, mte_tlb_ram_page(env, ptr_mmu_idx, ptr), tag_access == MMU_DATA_STORE) + tag_offset;
 }
 
 uint64_t HELPER(irg)(CPUARMState *env, uint64_t rn, uint64_t rm)
@@ -202,37 +240,20 @@ uint64_t HELPER(irg)(CPUARMState *env, uint64_t rn, uint64_t rm)
     int seed = extract32(env->cp15.rgsr_el1, 8, 16);
     int offset, i, rtag;
 
-    /*
-     * Our IMPDEF choice for GCR_EL1.RRND==1 is to continue to use the
-     * deterministic algorithm.  Except that with RRND==1 the kernel is
-     * not required to have set RGSR_EL1.SEED != 0, which is required for
-     * the deterministic algorithm to function.  So we force a non-zero
-     * SEED for that case.
-     */
-    if(unlikely(seed == 0) && rrnd) {
-        do {
-            Error *err = NULL;
-            uint16_t two = 0;
-
-            if(qemu_guest_getrandom(&two, sizeof(two), &err) < 0) {
-                /*
-                 * Failed, for unknown reasons in the crypto subsystem.
-                 * Best we can do is log the reason and use a constant seed.
-                 */
-                tlib_printf(LOG_LEVEL_WARNING, "IRG: Crypto failure: %s", error_get_pretty(err));
-                error_free(err);
-                two = 1;
-            }
-            seed = two;
-        } while(seed == 0);
-    }
-
-    /* RandomTag */
-    for(i = offset = 0; i < 4; ++i) {
-        /* NextRandomTagBit */
-        int top = (extract32(seed, 5, 1) ^ extract32(seed, 3, 1) ^ extract32(seed, 2, 1) ^ extract32(seed, 0, 1));
-        seed = (top << 15) | (seed >> 1);
-        offset |= top << i;
+    if(rrnd) {
+        /*
+         * GCR_EL1.RRND==1 selects an IMPLEMENTATION DEFINED generator, so
+         * take the offset from the host's random source like RNDR does.
+         */
+        offset = extract64(tlib_get_random_ulong(), 0, 4);
+    } else {
+        /* RandomTag */
+        for(i = offset = 0; i < 4; ++i) {
+            /* NextRandomTagBit */
+            int top = (extract32(seed, 5, 1) ^ extract32(seed, 3, 1) ^ extract32(seed, 2, 1) ^ extract32(seed, 0, 1));
+            seed = (top << 15) | (seed >> 1);
+            offset |= top << i;
+        }
     }
     rtag = choose_nonexcluded_tag(start, offset, exclude);
     env->cp15.rgsr_el1 = rtag | (seed << 8);
@@ -275,7 +296,11 @@ uint64_t HELPER(ldg)(CPUARMState *env, uint64_t ptr, uint64_t xt)
 static void check_tag_aligned(CPUARMState *env, uint64_t ptr, uintptr_t ra)
 {
     if(unlikely((ptr % TAG_GRANULE) != 0)) {
-        arm_cpu_do_unaligned_access(env_cpu(env), ptr, MMU_DATA_STORE, cpu_mmu_index(env), ra);
+        uint32_t target_el = exception_target_el(env);
+        uint32_t syn = syn_data_abort_no_iss(target_el == arm_current_el(env), 0, 0, 0, 0, 1, SYN_FAULT_ALIGNMENT);
+
+        env->exception.vaddress = ptr;
+        raise_exception_ra(env, EXCP_DATA_ABORT, syn, target_el, ra);
         g_assert_not_reached();
     }
 }
@@ -291,15 +316,14 @@ static void store_tag1(uint64_t ptr, uint8_t *mem, int tag)
 static void store_tag1_parallel(uint64_t ptr, uint8_t *mem, int tag)
 {
     int ofs = extract32(ptr, LOG2_TAG_GRANULE, 1) * 4;
-    uint8_t old = qatomic_read(mem);
+    uint8_t old = __atomic_load_n(mem, __ATOMIC_RELAXED);
 
     while(1) {
         uint8_t new = deposit32(old, ofs, 4, tag);
-        uint8_t cmp = qatomic_cmpxchg(mem, old, new);
-        if(likely(cmp == old)) {
+        //  On failure 'old' is updated with the current value.
+        if(likely(__atomic_compare_exchange_n(mem, &old, new, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))) {
             return;
         }
-        old = cmp;
     }
 }
 
@@ -369,7 +393,7 @@ static inline void do_st2g(CPUARMState *env, uint64_t ptr, uint64_t xt, uintptr_
         mem1 = allocation_tag_mem(env, mmu_idx, ptr, MMU_DATA_STORE, 2 * TAG_GRANULE, MMU_DATA_STORE, 1, ra);
         if(mem1) {
             tag |= tag << 4;
-            qatomic_set(mem1, tag);
+            __atomic_store_n(mem1, tag, __ATOMIC_RELAXED);
         }
     }
 }
@@ -435,7 +459,7 @@ void HELPER(stgm)(CPUARMState *env, uint64_t ptr, uint64_t val)
     ptr = ALIGN_DOWN(ptr, LDGM_STGM_SIZE);
 
     /* Trap if accessing an invalid page.  */
-    tag_mem = allocation_tag_mem(env, mmu_idx, ptr, MMU_DATA_STORE, LDGM_STGM_SIZE, MMU_DATA_LOAD,
+    tag_mem = allocation_tag_mem(env, mmu_idx, ptr, MMU_DATA_STORE, LDGM_STGM_SIZE, MMU_DATA_STORE,
                                  LDGM_STGM_SIZE / (2 * TAG_GRANULE), ra);
 
     /*
@@ -511,7 +535,7 @@ static void mte_check_fail(CPUARMState *env, uint32_t desc, uint64_t dirty_ptr,
     int el, reg_el, tcf;
     uint64_t sctlr;
 
-    reg_el = regime_el(env, arm_mmu_idx);
+    reg_el = address_translation_el(env, arm_mmu_idx_to_el(arm_mmu_idx));
     sctlr = env->cp15.sctlr_el[reg_el];
 
     switch(arm_mmu_idx) {
@@ -69,53 +69,11 @@ typedef struct MemTxAttrs {
     int target_tlb_bit1;
 } MemTxAttrs;
 
-#define HAVE_CMPXCHG128 stub_abort("HAVE_CMPXCHG128")
-FUNC_STUB(cpu_atomic_cmpxchgo_be_mmu)
-FUNC_STUB(cpu_atomic_cmpxchgo_le_mmu)
 FUNC_STUB_PTR(probe_access)
-FUNC_STUB_GENERIC_PTR(probe_write, void *)
-FUNC_STUB_GENERIC(tlb_vaddr_to_host, void *)
-
-#define MO_128 stub_abort("MO_128")
-
-//  Couldn't have been ported easily because of a complex softfloat licensing.
-#define float16_one_point_five stub_abort("float16_one_point_five")
-#define float16_three          stub_abort("float16_three")
-#define float16_two            stub_abort("float16_two")
-FUNC_STUB(float16_abs)
-FUNC_STUB(float16_add)
-FUNC_STUB(float16_chs)
-FUNC_STUB(float16_compare_quiet)
-FUNC_STUB(float16_compare)
-FUNC_STUB(float16_div)
-FUNC_STUB(float16_is_any_nan)
-FUNC_STUB(float16_is_infinity)
-FUNC_STUB(float16_is_zero)
-FUNC_STUB(float16_max)
-FUNC_STUB(float16_maxnum)
-FUNC_STUB(float16_min)
-FUNC_STUB(float16_minnum)
-FUNC_STUB(float16_mul)
-FUNC_STUB(float16_muladd)
-FUNC_STUB(float16_round_to_int)
-FUNC_STUB(float16_sqrt)
-FUNC_STUB(float16_squash_input_denormal)
-FUNC_STUB(float16_sub)
-FUNC_STUB(float16_to_int16)
-FUNC_STUB(float16_to_uint16)
 
 FUNC_STUB(cpu_stb_mmuidx_ra)
 
-/* mte_helper.c */
-
-typedef int AddressSpace;
-typedef int Error;
-typedef int hwaddr;
-
-typedef struct {
-    int addr;
-    void *container;
-} MemoryRegion;
+/* sve_helper.c, translate-a64.c */
 
 typedef struct {
     MemTxAttrs attrs;
@@ -129,40 +87,15 @@ typedef struct {
     env_tlb_d_struct *d;
 } env_tlb_struct;
 
-FUNC_STUB_GENERIC_PTR(address_space_translate, void *)
-FUNC_STUB(address_with_allocation_tag)
-FUNC_STUB(allocation_tag_from_addr)
-FUNC_STUB_PTR(arm_cpu_do_unaligned_access)
 FUNC_STUB_PTR(cpu_check_watchpoint)
-FUNC_STUB_GENERIC_PTR(cpu_get_address_space, void *)
-FUNC_STUB(cpu_physical_memory_set_dirty_flag)
 FUNC_STUB_GENERIC_PTR(env_tlb, env_tlb_struct *)
-FUNC_STUB_PTR(error_free)
-FUNC_STUB_PTR(error_get_pretty)
-FUNC_STUB_GENERIC_PTR(memory_region_from_host, void *)
-FUNC_STUB_PTR(memory_region_get_ram_addr)
-FUNC_STUB_GENERIC_PTR(memory_region_get_ram_ptr, void *)
-FUNC_STUB_PTR(memory_region_is_ram)
 FUNC_STUB_PTR(probe_access_flags)
-FUNC_STUB_PTR(qatomic_cmpxchg)
-FUNC_STUB_PTR(qatomic_read)
-FUNC_STUB_PTR(qatomic_set)
-FUNC_STUB_PTR(qemu_guest_getrandom)
-FUNC_STUB_PTR(regime_el)
-FUNC_STUB(tbi_check)
-FUNC_STUB(tcma_check)
 FUNC_STUB_PTR(tlb_index)
-FUNC_STUB(useronly_clean_ptr)
 
 #define BP_MEM_READ            stub_abort("BP_MEM_READ")
 #define BP_MEM_WRITE           stub_abort("BP_MEM_WRITE")
-#define DIRTY_MEMORY_MIGRATION stub_abort("DIRTY_MEMORY_MIGRATION")
-#define LOG2_TAG_GRANULE       stub_abort("LOG2_TAG_GRANULE")
-#define TAG_GRANULE            stub_abort("TAG_GRANULE")
 #define TLB_WATCHPOINT         stub_abort("TLB_WATCHPOINT")
 
-#define HWADDR_PRIx "d"
-
 /* op_helper.c */
 
 typedef struct {
@@ -183,52 +116,14 @@ FUNC_STUB_PTR(v7m_sp_limit)
 typedef int FloatRelation;
 typedef int FloatRoundMode;
 
-FUNC_STUB(float16_to_float64)
-FUNC_STUB(float16_to_int16_scalbn)
-FUNC_STUB(float16_to_int32_round_to_zero)
-FUNC_STUB(float16_to_int32_scalbn)
-FUNC_STUB(float16_to_int32)
-FUNC_STUB(float16_to_int64_scalbn)
-FUNC_STUB(float16_to_uint16_scalbn)
-FUNC_STUB(float16_to_uint32_round_to_zero)
-FUNC_STUB(float16_to_uint32_scalbn)
-FUNC_STUB(float16_to_uint32)
-FUNC_STUB(float16_to_uint64_scalbn)
-FUNC_STUB(float32_to_int16_scalbn)
-FUNC_STUB(float32_to_uint16_scalbn)
-FUNC_STUB(float64_to_int16_scalbn)
-FUNC_STUB(float64_to_uint16_scalbn)
-FUNC_STUB(int16_to_float16_scalbn)
-FUNC_STUB(int16_to_float32_scalbn)
-FUNC_STUB(int16_to_float64_scalbn)
-FUNC_STUB(int32_to_float16_scalbn)
-FUNC_STUB(int64_to_float16_scalbn)
-FUNC_STUB(uint16_to_float16_scalbn)
-FUNC_STUB(uint16_to_float32_scalbn)
-FUNC_STUB(uint16_to_float64_scalbn)
-FUNC_STUB(uint32_to_float16_scalbn)
-FUNC_STUB(uint64_to_float16_scalbn)
-
 /* vec_helper.c */
 
 typedef int bfloat16;
 
-#define float16_zero           stub_abort("float16_zero")
 #define float_round_to_odd_inf stub_abort("float_round_to_odd_inf")
 
-FUNC_STUB(float16_eq_quiet)
-FUNC_STUB(float16_le)
-FUNC_STUB(float16_lt)
-FUNC_STUB(float16_set_sign)
-FUNC_STUB(float16_to_int16_round_to_zero)
-FUNC_STUB(float16_to_uint16_round_to_zero)
-FUNC_STUB(int16_to_float16)
-FUNC_STUB(uint16_to_float16)
-
 /* sve_helper.c */
 
-#define float16_infinity  stub_abort("float16_infinity")
-#define float16_one       stub_abort("float16_one")
 #define SVE_MTEDESC_SHIFT stub_abort("SVE_MTEDESC_SHIFT")
 
 FUNC_STUB_PTR(cpu_ldl_be_data_ra)
@@ -246,19 +141,11 @@ FUNC_STUB_PTR(cpu_stq_le_data_ra)
 FUNC_STUB_PTR(cpu_stw_be_data_ra)
 FUNC_STUB_PTR(cpu_stw_le_data_ra)
 FUNC_STUB_PTR(cpu_watchpoint_address_matches)
-FUNC_STUB(float16_is_neg)
-FUNC_STUB(float16_scalbn)
-FUNC_STUB(float16_to_int64_round_to_zero)
-FUNC_STUB(float16_to_uint64_round_to_zero)
 FUNC_STUB(float32_to_bfloat16)
 FUNC_STUB(float32_to_uint64_round_to_zero)
 FUNC_STUB(hswap32)
 FUNC_STUB(hswap64)
-FUNC_STUB(int32_to_float16)
-FUNC_STUB(int64_to_float16)
 FUNC_STUB(pow2floor)
-FUNC_STUB(uint32_to_float16)
-FUNC_STUB(uint64_to_float16)
 FUNC_STUB(wswap64)
 
 /* translate-a64.c */
@@ -360,7 +247,6 @@ FUNC_STUB_GENERIC(gvec_fclt0_h, void)
 
 /* translate-sve.c */
 
-#define float16_half              stub_abort("float16_half")
 #define float_round_to_odd        stub_abort("float_round_to_odd")
 #define TCG_TARGET_HAS_bitsel_vec 0  //  TODO: Port bitsel_vec from TCG
 
@@ -398,15 +284,6 @@ FUNC_STUB_PTR(trans_FMINNM_zpzi)
 FUNC_STUB_PTR(trans_FMAX_zpzi)
 FUNC_STUB_PTR(trans_FMIN_zpzi)
 
-/* mte_helper.c */
-
-#define __REGISTER_MTEDESC_MIDX_START   stub_abort("__REGISTER_MTEDESC_MIDX_START")
-#define __REGISTER_MTEDESC_MIDX_WIDTH   stub_abort("__REGISTER_MTEDESC_MIDX_WIDTH")
-#define __REGISTER_MTEDESC_SIZEM1_START stub_abort("__REGISTER_MTEDESC_SIZEM1_START")
-#define __REGISTER_MTEDESC_SIZEM1_WIDTH stub_abort("__REGISTER_MTEDESC_SIZEM1_WIDTH")
-#define __REGISTER_MTEDESC_WRITE_START  stub_abort("__REGISTER_MTEDESC_WRITE_START")
-#define __REGISTER_MTEDESC_WRITE_WIDTH  stub_abort("__REGISTER_MTEDESC_WRITE_WIDTH")
-
 /* sve_helper.c */
 
 #define __REGISTER_PREDDESC_DATA_START  stub_abort("__REGISTER_PREDDESC_DATA_START")
@@ -416,13 +293,6 @@ FUNC_STUB_PTR(trans_FMIN_zpzi)
 #define __REGISTER_PREDDESC_OPRSZ_START stub_abort("__REGISTER_PREDDESC_OPRSZ_START")
 #define __REGISTER_PREDDESC_OPRSZ_WIDTH stub_abort("__REGISTER_PREDDESC_OPRSZ_WIDTH")
 
-/* translate-a64.c */
-
-#define __REGISTER_MTEDESC_TBI_START  stub_abort("__REGISTER_MTEDESC_TBI_START")
-#define __REGISTER_MTEDESC_TBI_WIDTH  stub_abort("__REGISTER_MTEDESC_TBI_WIDTH")
-#define __REGISTER_MTEDESC_TCMA_START stub_abort("__REGISTER_MTEDESC_TCMA_START")
-#define __REGISTER_MTEDESC_TCMA_WIDTH stub_abort("__REGISTER_MTEDESC_TCMA_WIDTH")
-
 //  Prototyped in translate-a32.h
 FUNC_STUB_PTR(mve_eci_check)
 FUNC_STUB_PTR(mve_update_eci)
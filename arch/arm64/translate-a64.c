@@ -20,6 +20,7 @@
 #include "cpu.h"
 
 #include "arm_ldst.h"
+#include "atomic-intrinsics.h"
 #include "syndrome.h"
 #include "system_registers.h"
 #include "tb-helper.h"
@@ -223,6 +224,53 @@ static void gen_probe_access(DisasContext *s, TCGv_i64 ptr, MMUAccessType acc, i
                             tcg_constant_i32(1 << log2_size));
 }
 
+/*
+ * Tags are shared with the other cores, so their stores have to be atomic
+ * whenever any other core is registered.
+ */
+static inline bool mte_tags_shared(DisasContext *s)
+{
+    return (tb_cflags(s->base.tb) & CF_PARALLEL) || tcg_context_are_multiple_cpus_registered();
+}
+
+/*
+ * Call the MTE check helper described by @desc for @addr unless the TLB entry
+ * of @addr is known to map untagged memory.  Entries filled from Tagged Normal
+ * memory have ARM_TLB_ATTR_MTE_TAGGED in their attributes, missing ones are -1,
+ * so both go through the helper, which also fills the TLB.  So do accesses
+ * crossing a page boundary, as the attributes are compared with the page of
+ * the last byte.
+ */
+static TCGv_i64 gen_mte_check(DisasContext *s, TCGv_i64 addr, int core_idx, uint32_t desc)
+{
+    //  Only local temps survive the branch
+    TCGv_i64 ret = new_tmp_a64_local(s);
+    TCGv_i64 attrs = tcg_temp_new_i64();
+    TCGv_i64 page = tcg_temp_new_i64();
+    TCGv_i32 index = tcg_temp_new_i32();
+    TCGv_ptr entry = tcg_temp_new_ptr();
+    int untagged = gen_new_label();
+
+    tcg_gen_mov_i64(ret, addr);
+    tcg_gen_extract_i64(page, addr, TARGET_PAGE_BITS, CPU_TLB_BITS);
+    tcg_gen_extrl_i64_i32(index, page);
+    tcg_gen_muli_i32(index, index, sizeof(target_ulong));
+    tcg_gen_ext_i32_ptr(entry, index);
+    tcg_gen_add_ptr(entry, entry, cpu_env);
+    tcg_gen_ld_i64(attrs, entry, offsetof(CPUState, tlb_attrs) + core_idx * CPU_TLB_SIZE * sizeof(target_ulong));
+    tcg_gen_addi_i64(page, addr, FIELD_EX32(desc, MTEDESC, SIZEM1));
+    tcg_gen_andi_i64(page, page, TARGET_PAGE_MASK);
+    tcg_gen_brcond_i64(TCG_COND_EQ, attrs, page, untagged);
+    tcg_temp_free_ptr(entry);
+    tcg_temp_free_i32(index);
+    tcg_temp_free_i64(page);
+    tcg_temp_free_i64(attrs);
+
+    gen_helper_mte_check(ret, cpu_env, tcg_constant_i32(desc), ret);
+    gen_set_label(untagged);
+    return ret;
+}
+
 /*
  * For MTE, check a single logical or atomic access.  This probes a single
  * address, the exact one specified.  The size and alignment of the access
@@ -233,7 +281,6 @@ static TCGv_i64 gen_mte_check1_mmuidx(DisasContext *s, TCGv_i64 addr, bool is_wr
                                       bool is_unpriv, int core_idx)
 {
     if(tag_checked && s->mte_active[is_unpriv]) {
-        TCGv_i64 ret;
         int desc = 0;
 
         desc = FIELD_DP32(desc, MTEDESC, MIDX, core_idx);
@@ -242,10 +289,7 @@ static TCGv_i64 gen_mte_check1_mmuidx(DisasContext *s, TCGv_i64 addr, bool is_wr
         desc = FIELD_DP32(desc, MTEDESC, WRITE, is_write);
         desc = FIELD_DP32(desc, MTEDESC, SIZEM1, (1 << log2_size) - 1);
 
-        ret = new_tmp_a64_local(s);
-        gen_helper_mte_check(ret, cpu_env, tcg_constant_i32(desc), addr);
-
-        return ret;
+        return gen_mte_check(s, addr, core_idx, desc);
     }
     return clean_data_tbi(s, addr);
 }
@@ -261,7 +305,6 @@ TCGv_i64 gen_mte_check1(DisasContext *s, TCGv_i64 addr, bool is_write, bool tag_
 TCGv_i64 gen_mte_checkN(DisasContext *s, TCGv_i64 addr, bool is_write, bool tag_checked, int size)
 {
     if(tag_checked && s->mte_active[0]) {
-        TCGv_i64 ret;
         int desc = 0;
 
         desc = FIELD_DP32(desc, MTEDESC, MIDX, get_mem_index(s));
@@ -270,10 +313,7 @@ TCGv_i64 gen_mte_checkN(DisasContext *s, TCGv_i64 addr, bool is_write, bool tag_
         desc = FIELD_DP32(desc, MTEDESC, WRITE, is_write);
         desc = FIELD_DP32(desc, MTEDESC, SIZEM1, size - 1);
 
-        ret = new_tmp_a64_local(s);
-        gen_helper_mte_check(ret, cpu_env, tcg_constant_i32(desc), addr);
-
-        return ret;
+        return gen_mte_check(s, addr, get_mem_index(s), desc);
     }
     return clean_data_tbi(s, addr);
 }
@@ -378,7 +418,7 @@ static inline void gen_goto_tb(DisasContext *s, int n, uint64_t dest)
         gen_exit_tb(tb, n);
     } else {
         gen_a64_set_pc_im(dest);
-        gen_exit_tb_no_chaining(tb);
+        gen_lookup_and_goto_ptr(tb);
     }
     s->base.is_jmp = DISAS_NORETURN;
 }
@@ -2716,6 +2756,24 @@ static void gen_compare_and_swap_pair(DisasContext *s, int rs, int rt, int rn, i
         */
         gen_store_table_lock_128(cpu, clean_addr, clean_addr_high);
 
+        int fallback = gen_new_label();
+        int done = gen_new_label();
+
+        /*
+            On a little-endian guest the first word in memory order is the low half,
+            so the pair can be swapped with a single host 128-bit compare and swap.
+            Misaligned, MMIO and otherwise unsuitable addresses take the fallback below,
+            which also raises the alignment fault.
+        */
+        if(s->be_data == MO_LE) {
+            TCGv_i128 actual = { .high = d2, .low = d1 };
+            TCGv_i128 expected = { .high = s2, .low = s1 };
+            TCGv_i128 new_value = { .high = t2, .low = t1 };
+            tcg_try_gen_atomic_compare_and_swap_intrinsic_i128(actual, expected, clean_addr, new_value, memidx, fallback);
+            tcg_gen_br(done);
+        }
+        gen_set_label(fallback);
+
         /* Load the two words, in memory order.  */
         tcg_gen_qemu_ld_i64(d1, clean_addr, memidx, MO_64 | MO_ALIGN_16 | s->be_data);
         tcg_gen_qemu_ld_i64(d2, clean_addr_high, memidx, MO_64 | s->be_data);
@@ -2734,6 +2792,8 @@ static void gen_compare_and_swap_pair(DisasContext *s, int rs, int rt, int rn, i
         tcg_temp_free_i64(c1);
         tcg_temp_free_i64(c2);
 
+        gen_set_label(done);
+
         /* Write back the data from memory to Rs.  */
         tcg_gen_mov_i64(s1, d1);
         tcg_gen_mov_i64(s2, d2);
@@ -3079,7 +3139,7 @@ static void disas_ldst_pair(DisasContext *s, uint32_t insn)
              * system mode, if we arrange to add MO_ALIGN_16.
              */
             gen_helper_stg_stub(cpu_env, dirty_addr);
-        } else if(tb_cflags(s->base.tb) & CF_PARALLEL) {
+        } else if(mte_tags_shared(s)) {
             gen_helper_stg_parallel(cpu_env, dirty_addr, dirty_addr);
         } else {
             gen_helper_stg(cpu_env, dirty_addr, dirty_addr);
@@ -4167,7 +4227,7 @@ static void disas_ldst_tag(DisasContext *s, uint32_t insn)
             } else {
                 gen_helper_stg_stub(cpu_env, addr);
             }
-        } else if(tb_cflags(s->base.tb) & CF_PARALLEL) {
+        } else if(mte_tags_shared(s)) {
             if(is_pair) {
                 gen_helper_st2g_parallel(cpu_env, addr, tcg_rt);
             } else {
@@ -2819,7 +2819,6 @@ static int disas_dsp_insn(DisasContext *s, uint32_t insn)
     return 1;
 }
 
-//  TODO: Remove the argument after porting 'tcg_gen_lookup_and_goto_ptr'.
 static void gen_goto_ptr(DisasContext *dc)
 {
     tcg_gen_lookup_and_goto_ptr(dc);
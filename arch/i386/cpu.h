@@ -597,7 +597,8 @@ typedef union {
     uint8_t _b[16];
     uint16_t _w[8];
     uint32_t _l[4];
-    uint64_t _q[2];
+    /* 16-byte aligned for the generic vector operations */
+    uint64_t _q[2] __attribute__((aligned(16)));
     float32 _s[4];
     float64 _d[2];
 } XMMReg;
@@ -1,7 +1,7 @@
 #include "def-helper.h"
 
-DEF_HELPER_FLAGS_1(cc_compute_all, TCG_CALL_PURE, i32, int)
-DEF_HELPER_FLAGS_1(cc_compute_c, TCG_CALL_PURE, i32, int)
+DEF_HELPER_FLAGS_1(cc_compute_all, TCG_CALL_NO_WG_SE, i32, int)
+DEF_HELPER_FLAGS_1(cc_compute_c, TCG_CALL_NO_WG_SE, i32, int)
 
 DEF_HELPER_2(write_eflags, void, tl, i32)
 DEF_HELPER_0(read_eflags, tl)
@@ -107,82 +107,82 @@ DEF_HELPER_1(invlpga, void, int)
 
 /* x86 FPU */
 
-DEF_HELPER_1(flds_FT0, void, i32)
-DEF_HELPER_1(fldl_FT0, void, i64)
-DEF_HELPER_1(fildl_FT0, void, s32)
-DEF_HELPER_1(flds_ST0, void, i32)
-DEF_HELPER_1(fldl_ST0, void, i64)
-DEF_HELPER_1(fildl_ST0, void, s32)
-DEF_HELPER_1(fildll_ST0, void, s64)
-DEF_HELPER_0(fsts_ST0, i32)
-DEF_HELPER_0(fstl_ST0, i64)
-DEF_HELPER_0(fist_ST0, s32)
-DEF_HELPER_0(fistl_ST0, s32)
-DEF_HELPER_0(fistll_ST0, s64)
-DEF_HELPER_0(fistt_ST0, s32)
-DEF_HELPER_0(fisttl_ST0, s32)
-DEF_HELPER_0(fisttll_ST0, s64)
+DEF_HELPER_FLAGS_1(flds_FT0, TCG_CALL_NO_RWG, void, i32)
+DEF_HELPER_FLAGS_1(fldl_FT0, TCG_CALL_NO_RWG, void, i64)
+DEF_HELPER_FLAGS_1(fildl_FT0, TCG_CALL_NO_RWG, void, s32)
+DEF_HELPER_FLAGS_1(flds_ST0, TCG_CALL_NO_RWG, void, i32)
+DEF_HELPER_FLAGS_1(fldl_ST0, TCG_CALL_NO_RWG, void, i64)
+DEF_HELPER_FLAGS_1(fildl_ST0, TCG_CALL_NO_RWG, void, s32)
+DEF_HELPER_FLAGS_1(fildll_ST0, TCG_CALL_NO_RWG, void, s64)
+DEF_HELPER_FLAGS_0(fsts_ST0, TCG_CALL_NO_RWG, i32)
+DEF_HELPER_FLAGS_0(fstl_ST0, TCG_CALL_NO_RWG, i64)
+DEF_HELPER_FLAGS_0(fist_ST0, TCG_CALL_NO_RWG, s32)
+DEF_HELPER_FLAGS_0(fistl_ST0, TCG_CALL_NO_RWG, s32)
+DEF_HELPER_FLAGS_0(fistll_ST0, TCG_CALL_NO_RWG, s64)
+DEF_HELPER_FLAGS_0(fistt_ST0, TCG_CALL_NO_RWG, s32)
+DEF_HELPER_FLAGS_0(fisttl_ST0, TCG_CALL_NO_RWG, s32)
+DEF_HELPER_FLAGS_0(fisttll_ST0, TCG_CALL_NO_RWG, s64)
 DEF_HELPER_1(fldt_ST0, void, tl)
 DEF_HELPER_1(fstt_ST0, void, tl)
-DEF_HELPER_0(fpush, void)
-DEF_HELPER_0(fpop, void)
-DEF_HELPER_0(fdecstp, void)
-DEF_HELPER_0(fincstp, void)
-DEF_HELPER_1(ffree_STN, void, int)
-DEF_HELPER_0(fmov_ST0_FT0, void)
-DEF_HELPER_1(fmov_FT0_STN, void, int)
-DEF_HELPER_1(fmov_ST0_STN, void, int)
-DEF_HELPER_1(fmov_STN_ST0, void, int)
-DEF_HELPER_1(fxchg_ST0_STN, void, int)
-DEF_HELPER_0(fcom_ST0_FT0, void)
-DEF_HELPER_0(fucom_ST0_FT0, void)
+DEF_HELPER_FLAGS_0(fpush, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fpop, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fdecstp, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fincstp, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_1(ffree_STN, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_0(fmov_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_1(fmov_FT0_STN, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fmov_ST0_STN, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fmov_STN_ST0, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fxchg_ST0_STN, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_0(fcom_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fucom_ST0_FT0, TCG_CALL_NO_RWG, void)
 DEF_HELPER_0(fcomi_ST0_FT0, void)
 DEF_HELPER_0(fucomi_ST0_FT0, void)
-DEF_HELPER_0(fadd_ST0_FT0, void)
-DEF_HELPER_0(fmul_ST0_FT0, void)
-DEF_HELPER_0(fsub_ST0_FT0, void)
-DEF_HELPER_0(fsubr_ST0_FT0, void)
-DEF_HELPER_0(fdiv_ST0_FT0, void)
-DEF_HELPER_0(fdivr_ST0_FT0, void)
-DEF_HELPER_1(fadd_STN_ST0, void, int)
-DEF_HELPER_1(fmul_STN_ST0, void, int)
-DEF_HELPER_1(fsub_STN_ST0, void, int)
-DEF_HELPER_1(fsubr_STN_ST0, void, int)
-DEF_HELPER_1(fdiv_STN_ST0, void, int)
-DEF_HELPER_1(fdivr_STN_ST0, void, int)
-DEF_HELPER_0(fchs_ST0, void)
-DEF_HELPER_0(fabs_ST0, void)
-DEF_HELPER_0(fxam_ST0, void)
-DEF_HELPER_0(fld1_ST0, void)
-DEF_HELPER_0(fldl2t_ST0, void)
-DEF_HELPER_0(fldl2e_ST0, void)
-DEF_HELPER_0(fldpi_ST0, void)
-DEF_HELPER_0(fldlg2_ST0, void)
-DEF_HELPER_0(fldln2_ST0, void)
-DEF_HELPER_0(fldz_ST0, void)
-DEF_HELPER_0(fldz_FT0, void)
-DEF_HELPER_0(fnstsw, i32)
-DEF_HELPER_0(fnstcw, i32)
+DEF_HELPER_FLAGS_0(fadd_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fmul_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fsub_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fsubr_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fdiv_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fdivr_ST0_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_1(fadd_STN_ST0, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fmul_STN_ST0, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fsub_STN_ST0, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fsubr_STN_ST0, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fdiv_STN_ST0, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_1(fdivr_STN_ST0, TCG_CALL_NO_RWG, void, int)
+DEF_HELPER_FLAGS_0(fchs_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fabs_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fxam_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fld1_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fldl2t_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fldl2e_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fldpi_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fldlg2_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fldln2_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fldz_ST0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fldz_FT0, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fnstsw, TCG_CALL_NO_RWG, i32)
+DEF_HELPER_FLAGS_0(fnstcw, TCG_CALL_NO_RWG, i32)
 DEF_HELPER_1(fldcw, void, i32)
 DEF_HELPER_0(fclex, void)
 DEF_HELPER_0(fwait, void)
 DEF_HELPER_0(fninit, void)
 DEF_HELPER_1(fbld_ST0, void, tl)
 DEF_HELPER_1(fbst_ST0, void, tl)
-DEF_HELPER_0(f2xm1, void)
-DEF_HELPER_0(fyl2x, void)
-DEF_HELPER_0(fptan, void)
-DEF_HELPER_0(fpatan, void)
-DEF_HELPER_0(fxtract, void)
-DEF_HELPER_0(fprem1, void)
-DEF_HELPER_0(fprem, void)
-DEF_HELPER_0(fyl2xp1, void)
-DEF_HELPER_0(fsqrt, void)
-DEF_HELPER_0(fsincos, void)
-DEF_HELPER_0(frndint, void)
-DEF_HELPER_0(fscale, void)
-DEF_HELPER_0(fsin, void)
-DEF_HELPER_0(fcos, void)
+DEF_HELPER_FLAGS_0(f2xm1, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fyl2x, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fptan, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fpatan, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fxtract, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fprem1, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fprem, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fyl2xp1, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fsqrt, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fsincos, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(frndint, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fscale, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fsin, TCG_CALL_NO_RWG, void)
+DEF_HELPER_FLAGS_0(fcos, TCG_CALL_NO_RWG, void)
 DEF_HELPER_2(fstenv, void, tl, int)
 DEF_HELPER_2(fldenv, void, tl, int)
 DEF_HELPER_2(fsave, void, tl, int)
@@ -3485,12 +3485,174 @@ static void fpu_set_exception(int mask)
     }
 }
 
+#ifdef X87_HOST_FPU
+/* The host FPU uses the same 80-bit extended format as the guest, so the
+   x87 arithmetic is executed natively.  The guest rounding and precision
+   control are loaded into the host control word with all exceptions
+   masked, and the exception flags the operation raised are merged into
+   the guest status word afterwards. */
+
+static inline long double x87_host_load(floatx80 a)
+{
+    long double r = 0;
+
+    memcpy(&r, &a, 10);
+    return r;
+}
+
+static inline floatx80 x87_host_store(long double a)
+{
+    floatx80 r;
+
+    memcpy(&r, &a, 10);
+    return r;
+}
+
+static inline uint16_t x87_host_enter(void)
+{
+    uint16_t host_cw;
+    uint16_t guest_cw = (env->fpuc & 0xf00) | 0x7f;
+
+    asm volatile("fnstcw %0" : "=m"(host_cw));
+    asm volatile("fnclex\n\t"
+                 "fldcw %0"
+                 :
+                 : "m"(guest_cw));
+    return host_cw;
+}
+
+/* sw is the host status word stored right after the operation, before
+   moving the result off the stack changes the condition codes */
+static inline uint16_t x87_host_leave(uint16_t host_cw, uint16_t sw)
+{
+    asm volatile("fldcw %0" : : "m"(host_cw));
+    if(sw & 0x3f) {
+        fpu_set_exception(sw & 0x3f);
+    }
+    return sw;
+}
+
+/* ST0 <- insn(ST0) */
+#define X87_HOST_UNARY(name, insn)                                \
+    static uint16_t x87_host_##name(floatx80 *a)                  \
+    {                                                             \
+        long double r = x87_host_load(*a);                        \
+        uint16_t sw, host_cw = x87_host_enter();                  \
+        asm volatile(insn "\n\tfnstsw %%ax" : "+t"(r), "=a"(sw)); \
+        *a = x87_host_store(r);                                   \
+        return x87_host_leave(host_cw, sw);                       \
+    }
+
+/* ST0 <- insn(ST0, ST1) */
+#define X87_HOST_BINARY(name, insn)                                                \
+    static uint16_t x87_host_##name(floatx80 *a, floatx80 b)                       \
+    {                                                                              \
+        long double r = x87_host_load(*a);                                         \
+        long double y = x87_host_load(b);                                          \
+        uint16_t sw, host_cw = x87_host_enter();                                   \
+        asm volatile(insn "\n\tfnstsw %%ax" : "=t"(r), "=a"(sw) : "0"(r), "u"(y)); \
+        *a = x87_host_store(r);                                                    \
+        return x87_host_leave(host_cw, sw);                                        \
+    }
+
+/* ST1 <- insn(ST0, ST1), then pop; the caller pops the guest stack */
+#define X87_HOST_BINARY_POP(name, insn)                                                       \
+    static uint16_t x87_host_##name(floatx80 *st1, floatx80 st0)                              \
+    {                                                                                         \
+        long double r = x87_host_load(st0);                                                   \
+        long double y = x87_host_load(*st1);                                                  \
+        uint16_t sw, host_cw = x87_host_enter();                                              \
+        asm volatile(insn "\n\tfnstsw %%ax" : "=t"(r), "=a"(sw) : "0"(r), "u"(y) : "st(1)"); \
+        *st1 = x87_host_store(r);                                                             \
+        return x87_host_leave(host_cw, sw);                                                   \
+    }
+
+X87_HOST_BINARY(add, "fadd %%st(1), %%st")
+X87_HOST_BINARY(sub, "fsub %%st(1), %%st")
+X87_HOST_BINARY(mul, "fmul %%st(1), %%st")
+X87_HOST_BINARY(div, "fdiv %%st(1), %%st")
+X87_HOST_BINARY(prem, "fprem")
+X87_HOST_BINARY(prem1, "fprem1")
+X87_HOST_BINARY(scale, "fscale")
+X87_HOST_BINARY_POP(yl2x, "fyl2x")
+X87_HOST_BINARY_POP(yl2xp1, "fyl2xp1")
+X87_HOST_BINARY_POP(patan, "fpatan")
+X87_HOST_UNARY(sqrt, "fsqrt")
+X87_HOST_UNARY(rndint, "frndint")
+X87_HOST_UNARY(2xm1, "f2xm1")
+X87_HOST_UNARY(sin, "fsin")
+X87_HOST_UNARY(cos, "fcos")
+
+/* ST0 <- insn(ST0), then push the second result; used for fptan/fsincos */
+#define X87_HOST_UNARY_PUSH(name, insn)                                             \
+    static uint16_t x87_host_##name(floatx80 *a, floatx80 *pushed)                  \
+    {                                                                               \
+        long double r = x87_host_load(*a);                                          \
+        long double p;                                                              \
+        uint16_t sw, host_cw = x87_host_enter();                                    \
+        asm volatile(insn "\n\tfnstsw %%ax" : "=t"(p), "=u"(r), "=a"(sw) : "0"(r)); \
+        *a = x87_host_store(r);                                                     \
+        *pushed = x87_host_store(p);                                                \
+        return x87_host_leave(host_cw, sw);                                         \
+    }
+
+X87_HOST_UNARY_PUSH(tan, "fptan")
+X87_HOST_UNARY_PUSH(sincos, "fsincos")
+
+#undef X87_HOST_UNARY
+#undef X87_HOST_BINARY
+#undef X87_HOST_BINARY_POP
+#undef X87_HOST_UNARY_PUSH
+
+/* the trigonometric instructions only accept finite operands below 2^63,
+   otherwise the operand is left in place and C2 is set */
+static inline bool x87_host_trig_operand(floatx80 a)
+{
+    return (a.high & 0x7fff) < 0x3fff + 63;
+}
+#endif
+
+static inline floatx80 helper_fadd(floatx80 a, floatx80 b)
+{
+#ifdef X87_HOST_FPU
+    x87_host_add(&a, b);
+    return a;
+#else
+    return floatx80_add(a, b, &env->fp_status);
+#endif
+}
+
+static inline floatx80 helper_fsub(floatx80 a, floatx80 b)
+{
+#ifdef X87_HOST_FPU
+    x87_host_sub(&a, b);
+    return a;
+#else
+    return floatx80_sub(a, b, &env->fp_status);
+#endif
+}
+
+static inline floatx80 helper_fmul(floatx80 a, floatx80 b)
+{
+#ifdef X87_HOST_FPU
+    x87_host_mul(&a, b);
+    return a;
+#else
+    return floatx80_mul(a, b, &env->fp_status);
+#endif
+}
+
 static inline floatx80 helper_fdiv(floatx80 a, floatx80 b)
 {
+#ifdef X87_HOST_FPU
+    x87_host_div(&a, b);
+    return a;
+#else
     if(floatx80_is_zero(b)) {
         fpu_set_exception(FPUS_ZE);
     }
     return floatx80_div(a, b, &env->fp_status);
+#endif
 }
 
 static void fpu_raise_exception(void)
@@ -3758,22 +3920,22 @@ void helper_fucomi_ST0_FT0(void)
 
 void helper_fadd_ST0_FT0(void)
 {
-    ST0 = floatx80_add(ST0, FT0, &env->fp_status);
+    ST0 = helper_fadd(ST0, FT0);
 }
 
 void helper_fmul_ST0_FT0(void)
 {
-    ST0 = floatx80_mul(ST0, FT0, &env->fp_status);
+    ST0 = helper_fmul(ST0, FT0);
 }
 
 void helper_fsub_ST0_FT0(void)
 {
-    ST0 = floatx80_sub(ST0, FT0, &env->fp_status);
+    ST0 = helper_fsub(ST0, FT0);
 }
 
 void helper_fsubr_ST0_FT0(void)
 {
-    ST0 = floatx80_sub(FT0, ST0, &env->fp_status);
+    ST0 = helper_fsub(FT0, ST0);
 }
 
 void helper_fdiv_ST0_FT0(void)
@@ -3790,22 +3952,22 @@ void helper_fdivr_ST0_FT0(void)
 
 void helper_fadd_STN_ST0(int st_index)
 {
-    ST(st_index) = floatx80_add(ST(st_index), ST0, &env->fp_status);
+    ST(st_index) = helper_fadd(ST(st_index), ST0);
 }
 
 void helper_fmul_STN_ST0(int st_index)
 {
-    ST(st_index) = floatx80_mul(ST(st_index), ST0, &env->fp_status);
+    ST(st_index) = helper_fmul(ST(st_index), ST0);
 }
 
 void helper_fsub_STN_ST0(int st_index)
 {
-    ST(st_index) = floatx80_sub(ST(st_index), ST0, &env->fp_status);
+    ST(st_index) = helper_fsub(ST(st_index), ST0);
 }
 
 void helper_fsubr_STN_ST0(int st_index)
 {
-    ST(st_index) = floatx80_sub(ST0, ST(st_index), &env->fp_status);
+    ST(st_index) = helper_fsub(ST0, ST(st_index));
 }
 
 void helper_fdiv_STN_ST0(int st_index)
@@ -4005,13 +4167,21 @@ void helper_fbst_ST0(target_ulong ptr)
 
 void helper_f2xm1(void)
 {
+#ifdef X87_HOST_FPU
+    x87_host_2xm1(&ST0);
+#else
     double val = floatx80_to_double(ST0);
     val = pow(2.0, val) - 1.0;
     ST0 = double_to_floatx80(val);
+#endif
 }
 
 void helper_fyl2x(void)
 {
+#ifdef X87_HOST_FPU
+    x87_host_yl2x(&ST1, ST0);
+    fpop();
+#else
     double fptemp = floatx80_to_double(ST0);
 
     if(fptemp > 0.0) {
@@ -4023,10 +4193,22 @@ void helper_fyl2x(void)
         env->fpus &= (~0x4700);
         env->fpus |= 0x400;
     }
+#endif
 }
 
 void helper_fptan(void)
 {
+#ifdef X87_HOST_FPU
+    if(x87_host_trig_operand(ST0)) {
+        floatx80 one;
+
+        x87_host_tan(&ST0, &one);
+        fpush();
+        ST0 = one;
+        env->fpus &= (~0x400); /* C2 <-- 0 */
+        return;
+    }
+#endif
     double fptemp = floatx80_to_double(ST0);
 
     if((fptemp > MAXTAN) || (fptemp < -MAXTAN)) {
@@ -4043,12 +4225,17 @@ void helper_fptan(void)
 
 void helper_fpatan(void)
 {
+#ifdef X87_HOST_FPU
+    x87_host_patan(&ST1, ST0);
+    fpop();
+#else
     double fptemp, fpsrcop;
 
     fpsrcop = floatx80_to_double(ST1);
     fptemp = floatx80_to_double(ST0);
     ST1 = double_to_floatx80(atan2(fpsrcop, fptemp));
     fpop();
+#endif
 }
 
 void helper_fxtract(void)
@@ -4076,6 +4263,11 @@ void helper_fxtract(void)
 
 void helper_fprem1(void)
 {
+#ifdef X87_HOST_FPU
+    uint16_t sw = x87_host_prem1(&ST0, ST1);
+
+    env->fpus = (env->fpus & ~0x4700) | (sw & 0x4700); /* (C3,C2,C1,C0) */
+#else
     double st0, st1, dblq, fpsrcop, fptemp;
     CPU_LDoubleU fpsrcop1, fptemp1;
     int expdif;
@@ -4130,10 +4322,16 @@ void helper_fprem1(void)
         st0 -= (st1 * fpsrcop * fptemp);
     }
     ST0 = double_to_floatx80(st0);
+#endif
 }
 
 void helper_fprem(void)
 {
+#ifdef X87_HOST_FPU
+    uint16_t sw = x87_host_prem(&ST0, ST1);
+
+    env->fpus = (env->fpus & ~0x4700) | (sw & 0x4700); /* (C3,C2,C1,C0) */
+#else
     double st0, st1, dblq, fpsrcop, fptemp;
     CPU_LDoubleU fpsrcop1, fptemp1;
     int expdif;
@@ -4189,10 +4387,15 @@ void helper_fprem(void)
         st0 -= (st1 * fpsrcop * fptemp);
     }
     ST0 = double_to_floatx80(st0);
+#endif
 }
 
 void helper_fyl2xp1(void)
 {
+#ifdef X87_HOST_FPU
+    x87_host_yl2xp1(&ST1, ST0);
+    fpop();
+#else
     double fptemp = floatx80_to_double(ST0);
 
     if((fptemp + 1.0) > 0.0) {
@@ -4204,6 +4407,7 @@ void helper_fyl2xp1(void)
         env->fpus &= (~0x4700);
         env->fpus |= 0x400;
     }
+#endif
 }
 
 void helper_fsqrt(void)
@@ -4212,11 +4416,26 @@ void helper_fsqrt(void)
         env->fpus &= (~0x4700); /* (C3,C2,C1,C0) <-- 0000 */
         env->fpus |= 0x400;
     }
+#ifdef X87_HOST_FPU
+    x87_host_sqrt(&ST0);
+#else
     ST0 = floatx80_sqrt(ST0, &env->fp_status);
+#endif
 }
 
 void helper_fsincos(void)
 {
+#ifdef X87_HOST_FPU
+    if(x87_host_trig_operand(ST0)) {
+        floatx80 cos;
+
+        x87_host_sincos(&ST0, &cos);
+        fpush();
+        ST0 = cos;
+        env->fpus &= (~0x400); /* C2 <-- 0 */
+        return;
+    }
+#endif
     double fptemp = floatx80_to_double(ST0);
 
     if((fptemp > MAXTAN) || (fptemp < -MAXTAN)) {
@@ -4232,21 +4451,36 @@ void helper_fsincos(void)
 
 void helper_frndint(void)
 {
+#ifdef X87_HOST_FPU
+    x87_host_rndint(&ST0);
+#else
     ST0 = floatx80_round_to_int(ST0, &env->fp_status);
+#endif
 }
 
 void helper_fscale(void)
 {
+#ifdef X87_HOST_FPU
+    x87_host_scale(&ST0, ST1);
+#else
     if(floatx80_is_any_nan(ST1)) {
         ST0 = ST1;
     } else {
         int n = floatx80_to_int32_round_to_zero(ST1, &env->fp_status);
         ST0 = floatx80_scalbn(ST0, n, &env->fp_status);
     }
+#endif
 }
 
 void helper_fsin(void)
 {
+#ifdef X87_HOST_FPU
+    if(x87_host_trig_operand(ST0)) {
+        x87_host_sin(&ST0);
+        env->fpus &= (~0x400); /* C2 <-- 0 */
+        return;
+    }
+#endif
     double fptemp = floatx80_to_double(ST0);
 
     if((fptemp > MAXTAN) || (fptemp < -MAXTAN)) {
@@ -4260,6 +4494,13 @@ void helper_fsin(void)
 
 void helper_fcos(void)
 {
+#ifdef X87_HOST_FPU
+    if(x87_host_trig_operand(ST0)) {
+        x87_host_cos(&ST0);
+        env->fpus &= (~0x400); /* C2 <-- 0 */
+        return;
+    }
+#endif
     double fptemp = floatx80_to_double(ST0);
 
     if((fptemp > MAXTAN) || (fptemp < -MAXTAN)) {
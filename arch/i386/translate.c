@@ -27,6 +27,7 @@
 #include "arch_callbacks.h"
 
 #include "tb-helper.h"
+#include "tcg-op-gvec.h"
 
 #include "debug.h"
 
@@ -803,9 +804,295 @@ static void gen_op_update_neg_cc(void)
     tcg_gen_mov_tl(cpu_cc_dst, cpu_T[0]);
 }
 
-/* compute eflags.C to reg */
-static void gen_compute_eflags_c(TCGv reg)
+/* Loads CC_DST (is_dst) or CC_SRC into reg, zero- or sign-extended from
+   the operand size of the flags computation. */
+static void gen_load_cc_ext(TCGv reg, int ot, bool is_dst, bool sign)
 {
+    tcg_gen_mov_tl(reg, is_dst ? cpu_cc_dst : cpu_cc_src);
+    if(sign) {
+        gen_exts(ot, reg);
+    } else {
+        gen_extu(ot, reg);
+    }
+}
+
+/* Computes the most significant bit of the operand size of val into reg. */
+static void gen_cc_msb(TCGv reg, TCGv val, int ot)
+{
+    tcg_gen_shri_tl(reg, val, (8 << ot) - 1);
+    tcg_gen_andi_tl(reg, reg, 1);
+}
+
+/* Computes eflags.C as 0 or 1 into reg for a cc_op known at translation
+   time.  Returns false, without generating anything, if the flag has to be
+   computed by the helper. reg may be one of the cc globals. */
+static bool gen_prepare_eflags_c(int cc_op, TCGv reg)
+{
+    int ot, op;
+    TCGv t0, t1;
+
+    if(cc_op == CC_OP_EFLAGS) {
+        tcg_gen_andi_tl(reg, cpu_cc_src, CC_C);
+        return true;
+    }
+    if(cc_op < CC_OP_MULB || cc_op >= CC_OP_NB) {
+        return false;
+    }
+    ot = (cc_op - CC_OP_MULB) & 3;
+    op = cc_op - ot;
+
+    switch(op) {
+        case CC_OP_MULB:
+            tcg_gen_setcondi_tl(TCG_COND_NE, reg, cpu_cc_src, 0);
+            return true;
+        case CC_OP_LOGICB:
+            tcg_gen_movi_tl(reg, 0);
+            return true;
+        case CC_OP_INCB:
+        case CC_OP_DECB:
+            tcg_gen_mov_tl(reg, cpu_cc_src);
+            return true;
+        case CC_OP_SHLB:
+            gen_cc_msb(reg, cpu_cc_src, ot);
+            return true;
+        case CC_OP_SARB:
+            tcg_gen_andi_tl(reg, cpu_cc_src, 1);
+            return true;
+        default:
+            break;
+    }
+
+    /* ADD/ADC: C = res <u src1, SUB/SBB: C = (res + src2) <u src2,
+       with <=u instead of <u when the carry was taken into account */
+    t0 = tcg_temp_new();
+    t1 = tcg_temp_new();
+    switch(op) {
+        case CC_OP_ADDB:
+        case CC_OP_ADCB:
+            tcg_gen_mov_tl(t0, cpu_cc_dst);
+            break;
+        case CC_OP_SBBB:
+            tcg_gen_add_tl(t0, cpu_cc_dst, cpu_cc_src);
+            tcg_gen_addi_tl(t0, t0, 1);
+            break;
+        default:
+            tcg_gen_add_tl(t0, cpu_cc_dst, cpu_cc_src);
+            break;
+    }
+    gen_extu(ot, t0);
+    gen_load_cc_ext(t1, ot, false, false);
+    tcg_gen_setcond_tl((op == CC_OP_ADCB || op == CC_OP_SBBB) ? TCG_COND_LEU : TCG_COND_LTU, reg, t0, t1);
+    tcg_temp_free(t1);
+    tcg_temp_free(t0);
+    return true;
+}
+
+/* Computes eflags.O as 0 or 1 into reg for a cc_op known at translation
+   time. */
+static bool gen_prepare_eflags_o(int cc_op, TCGv reg)
+{
+    int ot, op;
+    TCGv t0, t1;
+
+    if(cc_op == CC_OP_EFLAGS) {
+        tcg_gen_shri_tl(reg, cpu_cc_src, 11);
+        tcg_gen_andi_tl(reg, reg, 1);
+        return true;
+    }
+    if(cc_op < CC_OP_MULB || cc_op >= CC_OP_NB) {
+        return false;
+    }
+    ot = (cc_op - CC_OP_MULB) & 3;
+    op = cc_op - ot;
+
+    t0 = tcg_temp_new();
+    switch(op) {
+        case CC_OP_MULB:
+            tcg_gen_setcondi_tl(TCG_COND_NE, reg, cpu_cc_src, 0);
+            break;
+        case CC_OP_LOGICB:
+            tcg_gen_movi_tl(reg, 0);
+            break;
+        case CC_OP_INCB:
+        case CC_OP_DECB:
+            /* the result is the smallest negative number, or the largest
+               positive one */
+            gen_load_cc_ext(t0, ot, true, false);
+            tcg_gen_setcondi_tl(TCG_COND_EQ, reg, t0, ((target_ulong)1 << ((8 << ot) - 1)) - (op == CC_OP_DECB));
+            break;
+        case CC_OP_SHLB:
+        case CC_OP_SARB:
+            tcg_gen_xor_tl(t0, cpu_cc_src, cpu_cc_dst);
+            gen_cc_msb(reg, t0, ot);
+            break;
+        default:
+            /* the operands have equal (ADD/ADC) or different (SUB/SBB) signs
+               and the sign of the result differs from the first one */
+            t1 = tcg_temp_new();
+            if(op == CC_OP_ADDB || op == CC_OP_ADCB) {
+                tcg_gen_sub_tl(t1, cpu_cc_dst, cpu_cc_src);
+                if(op == CC_OP_ADCB) {
+                    tcg_gen_subi_tl(t1, t1, 1);
+                }
+                tcg_gen_eqv_tl(t1, t1, cpu_cc_src);
+                tcg_gen_xor_tl(t0, cpu_cc_src, cpu_cc_dst);
+            } else {
+                tcg_gen_add_tl(t0, cpu_cc_dst, cpu_cc_src);
+                if(op == CC_OP_SBBB) {
+                    tcg_gen_addi_tl(t0, t0, 1);
+                }
+                tcg_gen_xor_tl(t1, t0, cpu_cc_src);
+                tcg_gen_xor_tl(t0, t0, cpu_cc_dst);
+            }
+            tcg_gen_and_tl(t0, t0, t1);
+            gen_cc_msb(reg, t0, ot);
+            tcg_temp_free(t1);
+            break;
+    }
+    tcg_temp_free(t0);
+    return true;
+}
+
+/* Computes the condition selected by jcc_op (without the inversion bit) as
+   0 or 1 into reg for a cc_op known at translation time, without calling
+   the cc_compute helpers.  Returns false, without generating anything, for
+   CC_OP_DYNAMIC and for the parity flag, which is left to the helper. */
+static bool gen_prepare_cc(int cc_op, int jcc_op, TCGv reg)
+{
+    int ot;
+    TCGv t0, t1;
+
+    if(cc_op == CC_OP_EFLAGS) {
+        t0 = tcg_temp_new();
+        switch(jcc_op) {
+            case JCC_O:
+                tcg_gen_shri_tl(reg, cpu_cc_src, 11);
+                break;
+            case JCC_B:
+                tcg_gen_mov_tl(reg, cpu_cc_src);
+                break;
+            case JCC_Z:
+                tcg_gen_shri_tl(reg, cpu_cc_src, 6);
+                break;
+            case JCC_BE:
+                tcg_gen_shri_tl(t0, cpu_cc_src, 6);
+                tcg_gen_or_tl(reg, cpu_cc_src, t0);
+                break;
+            case JCC_S:
+                tcg_gen_shri_tl(reg, cpu_cc_src, 7);
+                break;
+            case JCC_P:
+                tcg_gen_shri_tl(reg, cpu_cc_src, 2);
+                break;
+            case JCC_L:
+                tcg_gen_shri_tl(t0, cpu_cc_src, 4); /* CC_O >> 4 == CC_S */
+                tcg_gen_xor_tl(reg, cpu_cc_src, t0);
+                tcg_gen_shri_tl(reg, reg, 7);
+                break;
+            default:
+            case JCC_LE:
+                tcg_gen_shri_tl(t0, cpu_cc_src, 4); /* CC_O >> 4 == CC_S */
+                tcg_gen_xor_tl(t0, cpu_cc_src, t0);
+                tcg_gen_shri_tl(t0, t0, 1); /* CC_S >> 1 == CC_Z */
+                tcg_gen_or_tl(reg, cpu_cc_src, t0);
+                tcg_gen_shri_tl(reg, reg, 6);
+                break;
+        }
+        tcg_gen_andi_tl(reg, reg, 1);
+        tcg_temp_free(t0);
+        return true;
+    }
+    if(cc_op < CC_OP_MULB || cc_op >= CC_OP_NB || jcc_op == JCC_P) {
+        return false;
+    }
+    ot = (cc_op - CC_OP_MULB) & 3;
+
+    /* after a compare the unsigned and signed relations can be taken from
+       the operands directly */
+    if(cc_op - ot == CC_OP_SUBB && jcc_op != JCC_O && jcc_op != JCC_Z && jcc_op != JCC_S) {
+        bool is_signed = jcc_op == JCC_L || jcc_op == JCC_LE;
+        TCGCond cond;
+
+        switch(jcc_op) {
+            case JCC_B:
+                cond = TCG_COND_LTU;
+                break;
+            case JCC_BE:
+                cond = TCG_COND_LEU;
+                break;
+            case JCC_L:
+                cond = TCG_COND_LT;
+                break;
+            default:
+                cond = TCG_COND_LE;
+                break;
+        }
+        t0 = tcg_temp_new();
+        t1 = tcg_temp_new();
+        tcg_gen_add_tl(t0, cpu_cc_dst, cpu_cc_src);
+        if(is_signed) {
+            gen_exts(ot, t0);
+        } else {
+            gen_extu(ot, t0);
+        }
+        gen_load_cc_ext(t1, ot, false, is_signed);
+        tcg_gen_setcond_tl(cond, reg, t0, t1);
+        tcg_temp_free(t1);
+        tcg_temp_free(t0);
+        return true;
+    }
+
+    switch(jcc_op) {
+        case JCC_O:
+            return gen_prepare_eflags_o(cc_op, reg);
+        case JCC_B:
+            return gen_prepare_eflags_c(cc_op, reg);
+        default:
+            break;
+    }
+
+    /* Z and S always come from the result */
+    t0 = tcg_temp_new();
+    if(jcc_op == JCC_Z || jcc_op == JCC_BE || jcc_op == JCC_LE) {
+        gen_load_cc_ext(t0, ot, true, false);
+        tcg_gen_setcondi_tl(TCG_COND_EQ, t0, t0, 0);
+    }
+    switch(jcc_op) {
+        case JCC_Z:
+            tcg_gen_mov_tl(reg, t0);
+            break;
+        case JCC_BE:
+            t1 = tcg_temp_new();
+            gen_prepare_eflags_c(cc_op, t1);
+            tcg_gen_or_tl(reg, t0, t1);
+            tcg_temp_free(t1);
+            break;
+        case JCC_S:
+            gen_cc_msb(reg, cpu_cc_dst, ot);
+            break;
+        default:
+        case JCC_L:
+        case JCC_LE:
+            t1 = tcg_temp_new();
+            gen_prepare_eflags_o(cc_op, t1);
+            gen_cc_msb(reg, cpu_cc_dst, ot);
+            tcg_gen_xor_tl(reg, reg, t1);
+            if(jcc_op == JCC_LE) {
+                tcg_gen_or_tl(reg, reg, t0);
+            }
+            tcg_temp_free(t1);
+            break;
+    }
+    tcg_temp_free(t0);
+    return true;
+}
+
+/* compute eflags.C to reg, cc_op is the value known at translation time */
+static void gen_compute_eflags_c(int cc_op, TCGv reg)
+{
+    if(gen_prepare_eflags_c(cc_op, reg)) {
+        return;
+    }
     gen_helper_cc_compute_c(cpu_tmp2_i32, cpu_cc_op);
     tcg_gen_extu_i32_tl(reg, cpu_tmp2_i32);
 }
@@ -817,8 +1104,11 @@ static void gen_compute_eflags(TCGv reg)
     tcg_gen_extu_i32_tl(reg, cpu_tmp2_i32);
 }
 
-static inline void gen_setcc_slow_T0(DisasContext *s, int jcc_op)
+static inline void gen_setcc_slow_T0(DisasContext *s, int cc_op, int jcc_op)
 {
+    if(gen_prepare_cc(cc_op, jcc_op, cpu_T[0])) {
+        return;
+    }
     if(s->cc_op != CC_OP_DYNAMIC) {
         gen_op_set_cc_op(s->cc_op);
     }
@@ -829,7 +1119,7 @@ static inline void gen_setcc_slow_T0(DisasContext *s, int jcc_op)
             tcg_gen_andi_tl(cpu_T[0], cpu_T[0], 1);
             break;
         case JCC_B:
-            gen_compute_eflags_c(cpu_T[0]);
+            gen_compute_eflags_c(CC_OP_DYNAMIC, cpu_T[0]);
             break;
         case JCC_Z:
             gen_compute_eflags(cpu_T[0]);
@@ -872,59 +1162,6 @@ static inline void gen_setcc_slow_T0(DisasContext *s, int jcc_op)
     }
 }
 
-/* return true if setcc_slow is not needed (WARNING: must be kept in
-   sync with gen_jcc1) */
-static int is_fast_jcc_case(DisasContext *s, int b)
-{
-    int jcc_op;
-    jcc_op = (b >> 1) & 7;
-    switch(s->cc_op) {
-        /* we optimize the cmp/jcc case */
-        case CC_OP_SUBB:
-        case CC_OP_SUBW:
-        case CC_OP_SUBL:
-        case CC_OP_SUBQ:
-            if(jcc_op == JCC_O || jcc_op == JCC_P) {
-                goto slow_jcc;
-            }
-            break;
-
-        /* some jumps are easy to compute */
-        case CC_OP_ADDB:
-        case CC_OP_ADDW:
-        case CC_OP_ADDL:
-        case CC_OP_ADDQ:
-
-        case CC_OP_LOGICB:
-        case CC_OP_LOGICW:
-        case CC_OP_LOGICL:
-        case CC_OP_LOGICQ:
-
-        case CC_OP_INCB:
-        case CC_OP_INCW:
-        case CC_OP_INCL:
-        case CC_OP_INCQ:
-
-        case CC_OP_DECB:
-        case CC_OP_DECW:
-        case CC_OP_DECL:
-        case CC_OP_DECQ:
-
-        case CC_OP_SHLB:
-        case CC_OP_SHLW:
-        case CC_OP_SHLL:
-        case CC_OP_SHLQ:
-            if(jcc_op != JCC_Z && jcc_op != JCC_S) {
-                goto slow_jcc;
-            }
-            break;
-        default:
-        slow_jcc:
-            return 0;
-    }
-    return 1;
-}
-
 /* generate a conditional jump to label 'l1' according to jump opcode
    value 'b'. In the fast case, T0 is guaranted not to be used. */
 static inline void gen_jcc1(DisasContext *s, int cc_op, int b, int l1)
@@ -1112,7 +1349,7 @@ static inline void gen_jcc1(DisasContext *s, int cc_op, int b, int l1)
             break;
         default:
         slow_jcc:
-            gen_setcc_slow_T0(s, jcc_op);
+            gen_setcc_slow_T0(s, cc_op, jcc_op);
             tcg_gen_brcondi_tl(inv ? TCG_COND_EQ : TCG_COND_NE, cpu_T[0], 0, l1);
             break;
     }
@@ -1313,7 +1550,7 @@ static void gen_op(DisasContext *s, int op, int ot, int d)
             if(s->cc_op != CC_OP_DYNAMIC) {
                 gen_op_set_cc_op(s->cc_op);
             }
-            gen_compute_eflags_c(cpu_tmp4);
+            gen_compute_eflags_c(s->cc_op, cpu_tmp4);
             tcg_gen_add_tl(cpu_T[0], cpu_T[0], cpu_T[1]);
             tcg_gen_add_tl(cpu_T[0], cpu_T[0], cpu_tmp4);
             if(d != OR_TMP0) {
@@ -1332,7 +1569,7 @@ static void gen_op(DisasContext *s, int op, int ot, int d)
             if(s->cc_op != CC_OP_DYNAMIC) {
                 gen_op_set_cc_op(s->cc_op);
             }
-            gen_compute_eflags_c(cpu_tmp4);
+            gen_compute_eflags_c(s->cc_op, cpu_tmp4);
             tcg_gen_sub_tl(cpu_T[0], cpu_T[0], cpu_T[1]);
             tcg_gen_sub_tl(cpu_T[0], cpu_T[0], cpu_tmp4);
             if(d != OR_TMP0) {
@@ -1408,6 +1645,8 @@ static void gen_op(DisasContext *s, int op, int ot, int d)
 /* if d == OR_TMP0, it means memory operand (address in A0) */
 static void gen_inc(DisasContext *s, int ot, int d, int c)
 {
+    int cc_op = s->cc_op;
+
     if(d != OR_TMP0) {
         gen_op_mov_TN_reg(ot, 0, d);
     } else {
@@ -1428,7 +1667,7 @@ static void gen_inc(DisasContext *s, int ot, int d, int c)
     } else {
         gen_op_st_T0_A0(ot + s->base.mem_idx);
     }
-    gen_compute_eflags_c(cpu_cc_src);
+    gen_compute_eflags_c(cc_op, cpu_cc_src);
     tcg_gen_mov_tl(cpu_cc_dst, cpu_T[0]);
 }
 
@@ -2404,30 +2643,14 @@ static inline void gen_jcc(DisasContext *s, int b, target_ulong val, target_ulon
 
 static void gen_setcc(DisasContext *s, int b)
 {
-    int inv, jcc_op, l1;
-    TCGv t0;
+    int inv, jcc_op;
 
-    if(is_fast_jcc_case(s, b)) {
-        /* nominal case: we use a jump */
-        /* XXX: make it faster by adding new instructions in TCG */
-        t0 = tcg_temp_local_new();
-        tcg_gen_movi_tl(t0, 0);
-        l1 = gen_new_label();
-        gen_jcc1(s, s->cc_op, b ^ 1, l1);
-        tcg_gen_movi_tl(t0, 1);
-        gen_set_label(l1);
-        tcg_gen_mov_tl(cpu_T[0], t0);
-        tcg_temp_free(t0);
-    } else {
-        /* slow case: it is more efficient not to generate a jump,
-           although it is questionnable whether this optimization is
-           worth to */
-        inv = b & 1;
-        jcc_op = (b >> 1) & 7;
-        gen_setcc_slow_T0(s, jcc_op);
-        if(inv) {
-            tcg_gen_xori_tl(cpu_T[0], cpu_T[0], 1);
-        }
+    /* the condition is computed without a jump, inline when cc_op is known */
+    inv = b & 1;
+    jcc_op = (b >> 1) & 7;
+    gen_setcc_slow_T0(s, s->cc_op, jcc_op);
+    if(inv) {
+        tcg_gen_xori_tl(cpu_T[0], cpu_T[0], 1);
     }
 }
 
@@ -2770,9 +2993,9 @@ static void gen_debug(DisasContext *s, target_ulong cur_eip)
     s->base.is_jmp = DISAS_TB_JUMP;
 }
 
-/* generate a generic end of block. Trace exception is also generated
-   if needed */
-static void gen_eob(DisasContext *s)
+/* generate an end of block. Trace exception is also generated if needed.
+   If 'jr', the next block is looked up without returning to the main loop */
+static void gen_eob_worker(DisasContext *s, bool jr)
 {
     if(s->cc_op != CC_OP_DYNAMIC) {
         gen_op_set_cc_op(s->cc_op);
@@ -2785,12 +3008,26 @@ static void gen_eob(DisasContext *s)
     }
     if(s->tf) {
         gen_helper_single_step();
+    } else if(jr) {
+        gen_lookup_and_goto_ptr(s->base.tb);
     } else {
         gen_exit_tb_no_chaining(s->base.tb);
     }
     s->base.is_jmp = DISAS_TB_JUMP;
 }
 
+/* generate a generic end of block */
+static void gen_eob(DisasContext *s)
+{
+    gen_eob_worker(s, false);
+}
+
+/* generate an end of block for an indirect jump to the eip already stored */
+static void gen_jr(DisasContext *s)
+{
+    gen_eob_worker(s, true);
+}
+
 /* generate a jump to eip. No segment change must happen before as a
    direct call to the next block may occur */
 static void gen_jmp_tb(DisasContext *s, target_ulong eip, int tb_num)
@@ -2846,10 +3083,7 @@ static inline void gen_sto_env_A0(int idx, int offset)
 
 static inline void gen_op_movo(int d_offset, int s_offset)
 {
-    tcg_gen_ld_i64(cpu_tmp1_i64, cpu_env, s_offset);
-    tcg_gen_st_i64(cpu_tmp1_i64, cpu_env, d_offset);
-    tcg_gen_ld_i64(cpu_tmp1_i64, cpu_env, s_offset + 8);
-    tcg_gen_st_i64(cpu_tmp1_i64, cpu_env, d_offset + 8);
+    tcg_gen_gvec_mov(MO_64, d_offset, s_offset, sizeof(XMMReg), sizeof(XMMReg));
 }
 
 static inline void gen_op_movq(int d_offset, int s_offset)
@@ -3095,6 +3329,89 @@ static struct sse_op_helper_s sse_op_table7[256] = {
     [0x61] = SSE42_OP(pcmpestri), [0x62] = SSE42_OP(pcmpistrm), [0x63] = SSE42_OP(pcmpistri),
 };
 
+/* Expands the integer and logical MMX/SSE operations that map directly onto
+   generic vector operations, size is 8 for MMX and 16 for SSE registers.
+   Returns false if the helper from sse_op_table1 has to be called.  */
+static bool gen_sse_gvec(int b, int op1_offset, int op2_offset, int size)
+{
+    switch(b) {
+        case 0x54: /* andps, andpd */
+        case 0xdb: /* pand */
+            tcg_gen_gvec_and(MO_64, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0x55: /* andnps, andnpd */
+        case 0xdf: /* pandn */
+            tcg_gen_gvec_andc(MO_64, op1_offset, op2_offset, op1_offset, size, size);
+            break;
+        case 0x56: /* orps, orpd */
+        case 0xeb: /* por */
+            tcg_gen_gvec_or(MO_64, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0x57: /* xorps, xorpd */
+        case 0xef: /* pxor */
+            tcg_gen_gvec_xor(MO_64, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xfc: /* paddb */
+        case 0xfd: /* paddw */
+        case 0xfe: /* paddl */
+            tcg_gen_gvec_add(b - 0xfc, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xd4: /* paddq */
+            tcg_gen_gvec_add(MO_64, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xf8: /* psubb */
+        case 0xf9: /* psubw */
+        case 0xfa: /* psubl */
+        case 0xfb: /* psubq */
+            tcg_gen_gvec_sub(b - 0xf8, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xec: /* paddsb */
+        case 0xed: /* paddsw */
+            tcg_gen_gvec_ssadd(b - 0xec, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xdc: /* paddusb */
+        case 0xdd: /* paddusw */
+            tcg_gen_gvec_usadd(b - 0xdc, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xe8: /* psubsb */
+        case 0xe9: /* psubsw */
+            tcg_gen_gvec_sssub(b - 0xe8, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xd8: /* psubusb */
+        case 0xd9: /* psubusw */
+            tcg_gen_gvec_ussub(b - 0xd8, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xd5: /* pmullw */
+            tcg_gen_gvec_mul(MO_16, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xda: /* pminub */
+            tcg_gen_gvec_umin(MO_8, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xde: /* pmaxub */
+            tcg_gen_gvec_umax(MO_8, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xea: /* pminsw */
+            tcg_gen_gvec_smin(MO_16, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0xee: /* pmaxsw */
+            tcg_gen_gvec_smax(MO_16, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0x74: /* pcmpeqb */
+        case 0x75: /* pcmpeqw */
+        case 0x76: /* pcmpeql */
+            tcg_gen_gvec_cmp(TCG_COND_EQ, b - 0x74, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        case 0x64: /* pcmpgtb */
+        case 0x65: /* pcmpgtw */
+        case 0x66: /* pcmpgtl */
+            tcg_gen_gvec_cmp(TCG_COND_GT, b - 0x64, op1_offset, op1_offset, op2_offset, size, size);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
 static void gen_sse(DisasContext *s, int b, target_ulong pc_start, int rex_r)
 {
     int b1, op1_offset, op2_offset, is_xmm, val, ot;
@@ -4053,6 +4370,9 @@ static void gen_sse(DisasContext *s, int b, target_ulong pc_start, int rex_r)
                 ((void (*)(TCGv_ptr, TCGv_ptr, TCGv))sse_op2)(cpu_ptr0, cpu_ptr1, cpu_A0);
                 break;
             default:
+                if(gen_sse_gvec(b, op1_offset, op2_offset, is_xmm ? sizeof(XMMReg) : sizeof(MMXReg))) {
+                    break;
+                }
                 tcg_gen_addi_ptr(cpu_ptr0, cpu_env, op1_offset);
                 tcg_gen_addi_ptr(cpu_ptr1, cpu_env, op2_offset);
                 ((void (*)(TCGv_ptr, TCGv_ptr))sse_op2)(cpu_ptr0, cpu_ptr1);
@@ -4631,7 +4951,7 @@ reswitch:
                     gen_movtl_T1_im(next_eip);
                     gen_push_T1(s);
                     gen_op_jmp_T0();
-                    gen_eob(s);
+                    gen_jr(s);
                     break;
                 case 3: /* lcall Ev */
                     gen_op_ld_T1_A0(ot + s->base.mem_idx);
@@ -4658,7 +4978,7 @@ reswitch:
                         gen_op_andl_T0_ffff();
                     }
                     gen_op_jmp_T0();
-                    gen_eob(s);
+                    gen_jr(s);
                     break;
                 case 5: /* ljmp Ev */
                     gen_op_ld_T1_A0(ot + s->base.mem_idx);
@@ -6187,7 +6507,7 @@ reswitch:
                 gen_op_andl_T0_ffff();
             }
             gen_op_jmp_T0();
-            gen_eob(s);
+            gen_jr(s);
             break;
         case 0xc3: /* ret */
             gen_pop_T0(s);
@@ -6196,7 +6516,7 @@ reswitch:
                 gen_op_andl_T0_ffff();
             }
             gen_op_jmp_T0();
-            gen_eob(s);
+            gen_jr(s);
             break;
         case 0xca: /* lret im */
             val = ldsw_code(s->base.pc);
@@ -6825,7 +7145,7 @@ reswitch:
             if(s->cc_op != CC_OP_DYNAMIC) {
                 gen_op_set_cc_op(s->cc_op);
             }
-            gen_compute_eflags_c(cpu_T[0]);
+            gen_compute_eflags_c(s->cc_op, cpu_T[0]);
             tcg_gen_neg_tl(cpu_T[0], cpu_T[0]);
             gen_op_mov_reg_T0(OT_BYTE, R_EAX);
             break;
@@ -6855,8 +7175,10 @@ reswitch:
                     }
                     gen_op_add_reg_im(s->aflag, R_ECX, -1);
                     gen_op_jz_ecx(s->aflag, l3);
-                    gen_compute_eflags(cpu_tmp0);
-                    tcg_gen_andi_tl(cpu_tmp0, cpu_tmp0, CC_Z);
+                    if(!gen_prepare_cc(s->cc_op, JCC_Z, cpu_tmp0)) {
+                        gen_compute_eflags(cpu_tmp0);
+                        tcg_gen_andi_tl(cpu_tmp0, cpu_tmp0, CC_Z);
+                    }
                     if(b == 0) {
                         tcg_gen_brcondi_tl(TCG_COND_EQ, cpu_tmp0, 0, l1);
                     } else {
@@ -325,7 +325,8 @@ union ppc_avr_t {
     int8_t s8[16];
     int16_t s16[8];
     int32_t s32[4];
-    uint64_t u64[2];
+    /* 16-byte aligned for the generic vector operations */
+    uint64_t u64[2] __attribute__((aligned(16)));
 };
 
 /* Software TLB cache */
@@ -618,6 +619,10 @@ enum {
 /* enabled exception summary */
 #define fpscr_eex (((env->fpscr) >> FPSCR_XX) & ((env->fpscr) >> FPSCR_XE) & 0x1F)
 
+/* Flags of the fused floating-point arithmetic helpers */
+#define FP_FUSED_SINGLE 0x1 /* Round the result to single precision (frsp)     */
+#define FP_FUSED_RC     0x2 /* Copy the FPRF condition code to CR1 (Rc = 1)    */
+
 /*****************************************************************************/
 /* Vector status and control register */
 #define VSCR_NJ  16 /* Vector non-java */
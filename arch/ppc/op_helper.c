@@ -1493,6 +1493,66 @@ uint64_t helper_fsel(uint64_t arg1, uint64_t arg2, uint64_t arg3)
     }
 }
 
+/* Fused floating-point arithmetic helpers: a single call per instruction instead of separate
+ * reset_fpstatus, operation, frsp, compute_fprf and float_check_status helpers. The steps are
+ * performed in the same order, in particular the target FPR and CR1 are updated before a deferred
+ * exception is raised.
+ */
+static inline void float_arith_fused_finish(uint32_t rd, uint64_t result, uint32_t flags)
+{
+    CPU_DoubleU farg;
+    uint32_t fpcc;
+
+    if(flags & FP_FUSED_SINGLE) {
+        result = helper_frsp(result);
+    }
+    farg.ll = result;
+    env->fpr[rd] = farg.d;
+    fpcc = helper_compute_fprf(result, 1);
+    if(unlikely(flags & FP_FUSED_RC)) {
+        env->crf[1] = fpcc;
+    }
+    helper_float_check_status();
+}
+
+#define FLOAT_ARITH_FUSED_1(name)                                         \
+    void helper_##name##_fused(uint32_t rd, uint64_t arg, uint32_t flags) \
+    {                                                                     \
+        helper_reset_fpstatus();                                          \
+        float_arith_fused_finish(rd, helper_##name(arg), flags);          \
+    }
+
+#define FLOAT_ARITH_FUSED_2(name)                                                         \
+    void helper_##name##_fused(uint32_t rd, uint64_t arg1, uint64_t arg2, uint32_t flags) \
+    {                                                                                     \
+        helper_reset_fpstatus();                                                          \
+        float_arith_fused_finish(rd, helper_##name(arg1, arg2), flags);                   \
+    }
+
+#define FLOAT_ARITH_FUSED_3(name)                                                                        \
+    void helper_##name##_fused(uint32_t rd, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint32_t flags) \
+    {                                                                                                    \
+        helper_reset_fpstatus();                                                                         \
+        float_arith_fused_finish(rd, helper_##name(arg1, arg2, arg3), flags);                            \
+    }
+
+FLOAT_ARITH_FUSED_2(fadd)
+FLOAT_ARITH_FUSED_2(fsub)
+FLOAT_ARITH_FUSED_2(fmul)
+FLOAT_ARITH_FUSED_2(fdiv)
+FLOAT_ARITH_FUSED_3(fmadd)
+FLOAT_ARITH_FUSED_3(fmsub)
+FLOAT_ARITH_FUSED_3(fnmadd)
+FLOAT_ARITH_FUSED_3(fnmsub)
+FLOAT_ARITH_FUSED_1(fsqrt)
+FLOAT_ARITH_FUSED_1(fre)
+FLOAT_ARITH_FUSED_1(fres)
+FLOAT_ARITH_FUSED_1(frsqrte)
+
+#undef FLOAT_ARITH_FUSED_1
+#undef FLOAT_ARITH_FUSED_2
+#undef FLOAT_ARITH_FUSED_3
+
 void helper_fcmpu(uint64_t arg1, uint64_t arg2, uint32_t crfD)
 {
     CPU_DoubleU farg1, farg2;
@@ -1973,23 +2033,6 @@ void helper_vaddcuw(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b)
     }
 }
 
-#define VARITH_DO(name, op, element)                              \
-    void helper_v##name(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b) \
-    {                                                             \
-        int i;                                                    \
-        for(i = 0; i < ARRAY_SIZE(r->element); i++) {             \
-            r->element[i] = a->element[i] op b->element[i];       \
-        }                                                         \
-    }
-#define VARITH(suffix, element)        \
-    VARITH_DO(add##suffix, +, element) \
-    VARITH_DO(sub##suffix, -, element)
-VARITH(ubm, u8)
-VARITH(uhm, u16)
-VARITH(uwm, u32)
-#undef VARITH_DO
-#undef VARITH
-
 #define VARITHFP(suffix, func)                                      \
     void helper_v##suffix(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b) \
     {                                                               \
@@ -2268,30 +2311,6 @@ void helper_vmhraddshs(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b, ppc_avr_t *c)
     }
 }
 
-#define VMINMAX_DO(name, compare, element)                        \
-    void helper_v##name(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b) \
-    {                                                             \
-        int i;                                                    \
-        for(i = 0; i < ARRAY_SIZE(r->element); i++) {             \
-            if(a->element[i] compare b->element[i]) {             \
-                r->element[i] = b->element[i];                    \
-            } else {                                              \
-                r->element[i] = a->element[i];                    \
-            }                                                     \
-        }                                                         \
-    }
-#define VMINMAX(suffix, element)        \
-    VMINMAX_DO(min##suffix, >, element) \
-    VMINMAX_DO(max##suffix, <, element)
-VMINMAX(sb, s8)
-VMINMAX(sh, s16)
-VMINMAX(sw, s32)
-VMINMAX(ub, u8)
-VMINMAX(uh, u16)
-VMINMAX(uw, u32)
-#undef VMINMAX_DO
-#undef VMINMAX
-
 #define VMINMAXFP(suffix, rT, rF)                                          \
     void helper_v##suffix(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b)        \
     {                                                                      \
@@ -2604,20 +2623,6 @@ VRFI(p, float_round_up)
 VRFI(z, float_round_to_zero)
 #undef VRFI
 
-#define VROTATE(suffix, element)                                                                               \
-    void helper_vrl##suffix(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b)                                          \
-    {                                                                                                          \
-        int i;                                                                                                 \
-        for(i = 0; i < ARRAY_SIZE(r->element); i++) {                                                          \
-            unsigned int mask = ((1 << (3 + (sizeof(a->element[0]) >> 1))) - 1);                               \
-            unsigned int shift = b->element[i] & mask;                                                         \
-            r->element[i] = (a->element[i] << shift) | (a->element[i] >> (sizeof(a->element[0]) * 8 - shift)); \
-        }                                                                                                      \
-    }
-VROTATE(b, u8)
-VROTATE(h, u16)
-VROTATE(w, u32)
-#undef VROTATE
 
 void helper_vrsqrtefp(ppc_avr_t *r, ppc_avr_t *b)
 {
@@ -2698,21 +2703,6 @@ VSHIFT(r, RIGHT)
 #undef LEFT
 #undef RIGHT
 
-#define VSL(suffix, element)                                                     \
-    void helper_vsl##suffix(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b)            \
-    {                                                                            \
-        int i;                                                                   \
-        for(i = 0; i < ARRAY_SIZE(r->element); i++) {                            \
-            unsigned int mask = ((1 << (3 + (sizeof(a->element[0]) >> 1))) - 1); \
-            unsigned int shift = b->element[i] & mask;                           \
-            r->element[i] = a->element[i] << shift;                              \
-        }                                                                        \
-    }
-VSL(b, u8)
-VSL(h, u16)
-VSL(w, u32)
-#undef VSL
-
 void helper_vsldoi(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b, uint32_t shift)
 {
     int sh = shift & 0xf;
@@ -2754,61 +2744,6 @@ void helper_vslo(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b)
 #endif
 }
 
-/* Experimental testing shows that hardware masks the immediate.  */
-#define _SPLAT_MASKED(element) (splat & (ARRAY_SIZE(r->element) - 1))
-#if defined(HOST_WORDS_BIGENDIAN)
-#define SPLAT_ELEMENT(element) _SPLAT_MASKED(element)
-#else
-#define SPLAT_ELEMENT(element) (ARRAY_SIZE(r->element) - 1 - _SPLAT_MASKED(element))
-#endif
-#define VSPLT(suffix, element)                                            \
-    void helper_vsplt##suffix(ppc_avr_t *r, ppc_avr_t *b, uint32_t splat) \
-    {                                                                     \
-        uint32_t s = b->element[SPLAT_ELEMENT(element)];                  \
-        int i;                                                            \
-        for(i = 0; i < ARRAY_SIZE(r->element); i++) {                     \
-            r->element[i] = s;                                            \
-        }                                                                 \
-    }
-VSPLT(b, u8)
-VSPLT(h, u16)
-VSPLT(w, u32)
-#undef VSPLT
-#undef SPLAT_ELEMENT
-#undef _SPLAT_MASKED
-
-#define VSPLTI(suffix, element, splat_type)                   \
-    void helper_vspltis##suffix(ppc_avr_t *r, uint32_t splat) \
-    {                                                         \
-        splat_type x = (int8_t)(splat << 3) >> 3;             \
-        int i;                                                \
-        for(i = 0; i < ARRAY_SIZE(r->element); i++) {         \
-            r->element[i] = x;                                \
-        }                                                     \
-    }
-VSPLTI(b, s8, int8_t)
-VSPLTI(h, s16, int16_t)
-VSPLTI(w, s32, int32_t)
-#undef VSPLTI
-
-#define VSR(suffix, element)                                                     \
-    void helper_vsr##suffix(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b)            \
-    {                                                                            \
-        int i;                                                                   \
-        for(i = 0; i < ARRAY_SIZE(r->element); i++) {                            \
-            unsigned int mask = ((1 << (3 + (sizeof(a->element[0]) >> 1))) - 1); \
-            unsigned int shift = b->element[i] & mask;                           \
-            r->element[i] = a->element[i] >> shift;                              \
-        }                                                                        \
-    }
-VSR(ab, s8)
-VSR(ah, s16)
-VSR(aw, s32)
-VSR(b, u8)
-VSR(h, u16)
-VSR(w, u32)
-#undef VSR
-
 void helper_vsro(ppc_avr_t *r, ppc_avr_t *a, ppc_avr_t *b)
 {
     int sh = (b->u8[LO_IDX * 0xf] >> 3) & 0xf;
@@ -27,8 +27,10 @@
 
 #include "cpu.h"
 #include "host-utils.h"
+#include "bit_helper.h"
 
 #include "tb-helper.h"
+#include "tcg-op-gvec.h"
 
 #include "debug.h"
 
@@ -40,7 +42,6 @@
 static TCGv cpu_gpr[32];
 static TCGv cpu_gprh[32];
 static TCGv_i64 cpu_fpr[32];
-static TCGv_i64 cpu_avrh[32], cpu_avrl[32];
 static TCGv_i32 cpu_crf[8];
 static TCGv cpu_nip;
 static TCGv cpu_msr;
@@ -64,7 +65,6 @@ void translate_init(void)
     static char cpu_reg_names[10 * 3 + 22 * 4         /* GPR */
                               + 10 * 4 + 22 * 5       /* SPE GPRh */
                               + 10 * 4 + 22 * 5       /* FPR */
-                              + 2 * (10 * 6 + 22 * 7) /* AVRh, AVRl */
                               + 8 * 5 /* CRF */];
 
     p = cpu_reg_names;
@@ -91,24 +91,6 @@ void translate_init(void)
         cpu_fpr[i] = tcg_global_mem_new_i64(TCG_AREG0, offsetof(CPUState, fpr[i]), p);
         p += (i < 10) ? 4 : 5;
         cpu_reg_names_size -= (i < 10) ? 4 : 5;
-
-        snprintf(p, cpu_reg_names_size, "avr%dH", i);
-#ifdef HOST_WORDS_BIGENDIAN
-        cpu_avrh[i] = tcg_global_mem_new_i64(TCG_AREG0, offsetof(CPUState, avr[i].u64[0]), p);
-#else
-        cpu_avrh[i] = tcg_global_mem_new_i64(TCG_AREG0, offsetof(CPUState, avr[i].u64[1]), p);
-#endif
-        p += (i < 10) ? 6 : 7;
-        cpu_reg_names_size -= (i < 10) ? 6 : 7;
-
-        snprintf(p, cpu_reg_names_size, "avr%dL", i);
-#ifdef HOST_WORDS_BIGENDIAN
-        cpu_avrl[i] = tcg_global_mem_new_i64(TCG_AREG0, offsetof(CPUState, avr[i].u64[1]), p);
-#else
-        cpu_avrl[i] = tcg_global_mem_new_i64(TCG_AREG0, offsetof(CPUState, avr[i].u64[0]), p);
-#endif
-        p += (i < 10) ? 6 : 7;
-        cpu_reg_names_size -= (i < 10) ? 6 : 7;
     }
 
     cpu_nip = tcg_global_mem_new(TCG_AREG0, offsetof(CPUState, nip), "nip");
@@ -1892,62 +1874,70 @@ static void gen_srd(DisasContext *s)
 #endif
 
 /***                       Floating-Point arithmetic                       ***/
-#define _GEN_FLOAT_ACB(name, op, op1, op2, isfloat, set_fprf, type)                                                       \
-    static void gen_f##name(DisasContext *s)                                                                              \
-    {                                                                                                                     \
-        if(unlikely(!s->fpu_enabled)) {                                                                                   \
-            gen_exception(s, POWERPC_EXCP_FPU);                                                                           \
-            return;                                                                                                       \
-        }                                                                                                                 \
-        /* NIP cannot be restored if the memory exception comes from an helper */                                         \
-        gen_update_nip(s, s->base.pc - 4);                                                                                \
-        gen_reset_fpstatus();                                                                                             \
-        gen_helper_f##op(cpu_fpr[rD(s->opcode)], cpu_fpr[rA(s->opcode)], cpu_fpr[rC(s->opcode)], cpu_fpr[rB(s->opcode)]); \
-        if(isfloat) {                                                                                                     \
-            gen_helper_frsp(cpu_fpr[rD(s->opcode)], cpu_fpr[rD(s->opcode)]);                                              \
-        }                                                                                                                 \
-        gen_compute_fprf(cpu_fpr[rD(s->opcode)], set_fprf, Rc(s->opcode) != 0);                                           \
+/* Arithmetic instructions call a single fused helper, which also writes the target FPR,
+ * updates FPRF (and CR1 for the Rc forms) and raises deferred exceptions.
+ */
+static inline TCGv_i32 gen_float_fused_flags(DisasContext *s, int isfloat)
+{
+    return tcg_const_i32((isfloat ? FP_FUSED_SINGLE : 0) | (Rc(s->opcode) ? FP_FUSED_RC : 0));
+}
+
+#define _GEN_FLOAT_ACB(name, op, op1, op2, isfloat, set_fprf, type)                                                  \
+    static void gen_f##name(DisasContext *s)                                                                         \
+    {                                                                                                                \
+        TCGv_i32 rd, flags;                                                                                          \
+        if(unlikely(!s->fpu_enabled)) {                                                                              \
+            gen_exception(s, POWERPC_EXCP_FPU);                                                                      \
+            return;                                                                                                  \
+        }                                                                                                            \
+        /* NIP cannot be restored if the memory exception comes from an helper */                                    \
+        gen_update_nip(s, s->base.pc - 4);                                                                           \
+        rd = tcg_const_i32(rD(s->opcode));                                                                           \
+        flags = gen_float_fused_flags(s, isfloat);                                                                   \
+        gen_helper_f##op##_fused(rd, cpu_fpr[rA(s->opcode)], cpu_fpr[rC(s->opcode)], cpu_fpr[rB(s->opcode)], flags); \
+        tcg_temp_free_i32(flags);                                                                                    \
+        tcg_temp_free_i32(rd);                                                                                       \
     }
 
 #define GEN_FLOAT_ACB(name, op2, set_fprf, type)              \
     _GEN_FLOAT_ACB(name, name, 0x3F, op2, 0, set_fprf, type); \
     _GEN_FLOAT_ACB(name##s, name, 0x3B, op2, 1, set_fprf, type);
 
-#define _GEN_FLOAT_AB(name, op, op1, op2, inval, isfloat, set_fprf, type)                         \
-    static void gen_f##name(DisasContext *s)                                                      \
-    {                                                                                             \
-        if(unlikely(!s->fpu_enabled)) {                                                           \
-            gen_exception(s, POWERPC_EXCP_FPU);                                                   \
-            return;                                                                               \
-        }                                                                                         \
-        /* NIP cannot be restored if the memory exception comes from an helper */                 \
-        gen_update_nip(s, s->base.pc - 4);                                                        \
-        gen_reset_fpstatus();                                                                     \
-        gen_helper_f##op(cpu_fpr[rD(s->opcode)], cpu_fpr[rA(s->opcode)], cpu_fpr[rB(s->opcode)]); \
-        if(isfloat) {                                                                             \
-            gen_helper_frsp(cpu_fpr[rD(s->opcode)], cpu_fpr[rD(s->opcode)]);                      \
-        }                                                                                         \
-        gen_compute_fprf(cpu_fpr[rD(s->opcode)], set_fprf, Rc(s->opcode) != 0);                   \
+#define _GEN_FLOAT_AB(name, op, op1, op2, inval, isfloat, set_fprf, type)                    \
+    static void gen_f##name(DisasContext *s)                                                 \
+    {                                                                                        \
+        TCGv_i32 rd, flags;                                                                  \
+        if(unlikely(!s->fpu_enabled)) {                                                      \
+            gen_exception(s, POWERPC_EXCP_FPU);                                              \
+            return;                                                                          \
+        }                                                                                    \
+        /* NIP cannot be restored if the memory exception comes from an helper */            \
+        gen_update_nip(s, s->base.pc - 4);                                                   \
+        rd = tcg_const_i32(rD(s->opcode));                                                   \
+        flags = gen_float_fused_flags(s, isfloat);                                           \
+        gen_helper_f##op##_fused(rd, cpu_fpr[rA(s->opcode)], cpu_fpr[rB(s->opcode)], flags); \
+        tcg_temp_free_i32(flags);                                                            \
+        tcg_temp_free_i32(rd);                                                               \
     }
 #define GEN_FLOAT_AB(name, op2, inval, set_fprf, type)              \
     _GEN_FLOAT_AB(name, name, 0x3F, op2, inval, 0, set_fprf, type); \
     _GEN_FLOAT_AB(name##s, name, 0x3B, op2, inval, 1, set_fprf, type);
 
-#define _GEN_FLOAT_AC(name, op, op1, op2, inval, isfloat, set_fprf, type)                         \
-    static void gen_f##name(DisasContext *s)                                                      \
-    {                                                                                             \
-        if(unlikely(!s->fpu_enabled)) {                                                           \
-            gen_exception(s, POWERPC_EXCP_FPU);                                                   \
-            return;                                                                               \
-        }                                                                                         \
-        /* NIP cannot be restored if the memory exception comes from an helper */                 \
-        gen_update_nip(s, s->base.pc - 4);                                                        \
-        gen_reset_fpstatus();                                                                     \
-        gen_helper_f##op(cpu_fpr[rD(s->opcode)], cpu_fpr[rA(s->opcode)], cpu_fpr[rC(s->opcode)]); \
-        if(isfloat) {                                                                             \
-            gen_helper_frsp(cpu_fpr[rD(s->opcode)], cpu_fpr[rD(s->opcode)]);                      \
-        }                                                                                         \
-        gen_compute_fprf(cpu_fpr[rD(s->opcode)], set_fprf, Rc(s->opcode) != 0);                   \
+#define _GEN_FLOAT_AC(name, op, op1, op2, inval, isfloat, set_fprf, type)                    \
+    static void gen_f##name(DisasContext *s)                                                 \
+    {                                                                                        \
+        TCGv_i32 rd, flags;                                                                  \
+        if(unlikely(!s->fpu_enabled)) {                                                      \
+            gen_exception(s, POWERPC_EXCP_FPU);                                              \
+            return;                                                                          \
+        }                                                                                    \
+        /* NIP cannot be restored if the memory exception comes from an helper */            \
+        gen_update_nip(s, s->base.pc - 4);                                                   \
+        rd = tcg_const_i32(rD(s->opcode));                                                   \
+        flags = gen_float_fused_flags(s, isfloat);                                           \
+        gen_helper_f##op##_fused(rd, cpu_fpr[rA(s->opcode)], cpu_fpr[rC(s->opcode)], flags); \
+        tcg_temp_free_i32(flags);                                                            \
+        tcg_temp_free_i32(rd);                                                               \
     }
 #define GEN_FLOAT_AC(name, op2, inval, set_fprf, type)              \
     _GEN_FLOAT_AC(name, name, 0x3F, op2, inval, 0, set_fprf, type); \
@@ -1967,18 +1957,26 @@ static void gen_srd(DisasContext *s)
         gen_compute_fprf(cpu_fpr[rD(s->opcode)], set_fprf, Rc(s->opcode) != 0);   \
     }
 
-#define GEN_FLOAT_BS(name, op1, op2, set_fprf, type)                              \
-    static void gen_f##name(DisasContext *s)                                      \
-    {                                                                             \
-        if(unlikely(!s->fpu_enabled)) {                                           \
-            gen_exception(s, POWERPC_EXCP_FPU);                                   \
-            return;                                                               \
-        }                                                                         \
-        /* NIP cannot be restored if the memory exception comes from an helper */ \
-        gen_update_nip(s, s->base.pc - 4);                                        \
-        gen_reset_fpstatus();                                                     \
-        gen_helper_f##name(cpu_fpr[rD(s->opcode)], cpu_fpr[rB(s->opcode)]);       \
-        gen_compute_fprf(cpu_fpr[rD(s->opcode)], set_fprf, Rc(s->opcode) != 0);   \
+static inline void gen_float_b_fused(DisasContext *s, void (*gen_helper_fused)(TCGv_i32, TCGv_i64, TCGv_i32), int isfloat)
+{
+    TCGv_i32 rd, flags;
+    if(unlikely(!s->fpu_enabled)) {
+        gen_exception(s, POWERPC_EXCP_FPU);
+        return;
+    }
+    /* NIP cannot be restored if the memory exception comes from an helper */
+    gen_update_nip(s, s->base.pc - 4);
+    rd = tcg_const_i32(rD(s->opcode));
+    flags = gen_float_fused_flags(s, isfloat);
+    gen_helper_fused(rd, cpu_fpr[rB(s->opcode)], flags);
+    tcg_temp_free_i32(flags);
+    tcg_temp_free_i32(rd);
+}
+
+#define GEN_FLOAT_BS(name, op1, op2, set_fprf, type)         \
+    static void gen_f##name(DisasContext *s)                 \
+    {                                                        \
+        gen_float_b_fused(s, gen_helper_f##name##_fused, 0); \
     }
 
 /* fadd - fadds */
@@ -1999,6 +1997,12 @@ GEN_FLOAT_BS(rsqrte, 0x3F, 0x1A, 1, PPC_FLOAT_FRSQRTE);
 
 /* frsqrtes */
 static void gen_frsqrtes(DisasContext *s)
+{
+    gen_float_b_fused(s, gen_helper_frsqrte_fused, 1);
+}
+
+/* fsel */
+static void gen_fsel(DisasContext *s)
 {
     if(unlikely(!s->fpu_enabled)) {
         gen_exception(s, POWERPC_EXCP_FPU);
@@ -2007,13 +2011,10 @@ static void gen_frsqrtes(DisasContext *s)
     /* NIP cannot be restored if the memory exception comes from an helper */
     gen_update_nip(s, s->base.pc - 4);
     gen_reset_fpstatus();
-    gen_helper_frsqrte(cpu_fpr[rD(s->opcode)], cpu_fpr[rB(s->opcode)]);
-    gen_helper_frsp(cpu_fpr[rD(s->opcode)], cpu_fpr[rD(s->opcode)]);
-    gen_compute_fprf(cpu_fpr[rD(s->opcode)], 1, Rc(s->opcode) != 0);
+    gen_helper_fsel(cpu_fpr[rD(s->opcode)], cpu_fpr[rA(s->opcode)], cpu_fpr[rC(s->opcode)], cpu_fpr[rB(s->opcode)]);
+    gen_compute_fprf(cpu_fpr[rD(s->opcode)], 0, Rc(s->opcode) != 0);
 }
 
-/* fsel */
-_GEN_FLOAT_ACB(sel, sel, 0x3F, 0x17, 0, 0, PPC_FLOAT_FSEL);
 /* fsub - fsubs */
 GEN_FLOAT_AB(sub, 0x14, 0x000007C0, 1, PPC_FLOAT);
 /* Optional: */
@@ -2021,29 +2022,12 @@ GEN_FLOAT_AB(sub, 0x14, 0x000007C0, 1, PPC_FLOAT);
 /* fsqrt */
 static void gen_fsqrt(DisasContext *s)
 {
-    if(unlikely(!s->fpu_enabled)) {
-        gen_exception(s, POWERPC_EXCP_FPU);
-        return;
-    }
-    /* NIP cannot be restored if the memory exception comes from an helper */
-    gen_update_nip(s, s->base.pc - 4);
-    gen_reset_fpstatus();
-    gen_helper_fsqrt(cpu_fpr[rD(s->opcode)], cpu_fpr[rB(s->opcode)]);
-    gen_compute_fprf(cpu_fpr[rD(s->opcode)], 1, Rc(s->opcode) != 0);
+    gen_float_b_fused(s, gen_helper_fsqrt_fused, 0);
 }
 
 static void gen_fsqrts(DisasContext *s)
 {
-    if(unlikely(!s->fpu_enabled)) {
-        gen_exception(s, POWERPC_EXCP_FPU);
-        return;
-    }
-    /* NIP cannot be restored if the memory exception comes from an helper */
-    gen_update_nip(s, s->base.pc - 4);
-    gen_reset_fpstatus();
-    gen_helper_fsqrt(cpu_fpr[rD(s->opcode)], cpu_fpr[rB(s->opcode)]);
-    gen_helper_frsp(cpu_fpr[rD(s->opcode)], cpu_fpr[rD(s->opcode)]);
-    gen_compute_fprf(cpu_fpr[rD(s->opcode)], 1, Rc(s->opcode) != 0);
+    gen_float_b_fused(s, gen_helper_fsqrt_fused, 1);
 }
 
 /***                     Floating-Point multiply-and-add                   ***/
@@ -2930,7 +2914,10 @@ static void gen_stswx(DisasContext *s)
 
 /***                        Memory synchronisation                         ***/
 /* eieio */
-static void gen_eieio(DisasContext *s) { }
+static void gen_eieio(DisasContext *s)
+{
+    tcg_gen_mb(TCG_MO_ALL | TCG_BAR_SC);
+}
 
 /* isync */
 static void gen_isync(DisasContext *s)
@@ -3015,7 +3002,10 @@ static void gen_stdcx_(DisasContext *s)
 }
 #endif /* defined(TARGET_PPC64) */
 /* sync */
-static void gen_sync(DisasContext *s) { }
+static void gen_sync(DisasContext *s)
+{
+    tcg_gen_mb(TCG_MO_ALL | TCG_BAR_SC);
+}
 
 /* wait */
 static void gen_wait(DisasContext *s)
@@ -3249,7 +3239,7 @@ static inline void gen_goto_tb(DisasContext *s, int n, target_ulong dest)
         gen_exit_tb(tb, n);
     } else {
         tcg_gen_movi_tl(cpu_nip, dest & ~3);
-        gen_exit_tb_no_chaining(tb);
+        gen_lookup_and_goto_ptr(tb);
     }
 }
 
@@ -3364,7 +3354,7 @@ static inline void gen_bcond(DisasContext *s, int type)
         } else
 #endif
             tcg_gen_andi_tl(cpu_nip, target, ~3);
-        gen_exit_tb_no_chaining(s->base.tb);
+        gen_lookup_and_goto_ptr(s->base.tb);
         gen_set_label(l1);
 #if defined(TARGET_PPC64)
         if(!(s->sf_mode)) {
@@ -3372,7 +3362,7 @@ static inline void gen_bcond(DisasContext *s, int type)
         } else
 #endif
             tcg_gen_movi_tl(cpu_nip, s->base.pc);
-        gen_exit_tb_no_chaining(s->base.tb);
+        gen_lookup_and_goto_ptr(s->base.tb);
     }
 }
 
@@ -5754,13 +5744,13 @@ static void gen_dlmzb(DisasContext *s)
 /* mbar replaces eieio on 440 */
 static void gen_mbar(DisasContext *s)
 {
-    /* interpreted as no-op */
+    gen_eieio(s);
 }
 
 /* msync replaces sync on 440 */
 static void gen_msync(DisasContext *s)
 {
-    /* interpreted as no-op */
+    gen_sync(s);
 }
 
 /* icbt */
@@ -5782,52 +5772,86 @@ static inline TCGv_ptr gen_avr_ptr(int reg)
     return r;
 }
 
-#define GEN_VR_LDX(name, opc2, opc3)                       \
-    static void glue(gen_, name)(DisasContext * s)         \
-    {                                                      \
-        TCGv EA;                                           \
-        if(unlikely(!s->altivec_enabled)) {                \
-            gen_exception(s, POWERPC_EXCP_VPU);            \
-            return;                                        \
-        }                                                  \
-        gen_set_access_type(s, ACCESS_INT);                \
-        EA = tcg_temp_new();                               \
-        gen_addr_reg_index(s, EA);                         \
-        tcg_gen_andi_tl(EA, EA, ~0xf);                     \
-        if(s->le_mode) {                                   \
-            gen_qemu_ld64(s, cpu_avrl[rD(s->opcode)], EA); \
-            tcg_gen_addi_tl(EA, EA, 8);                    \
-            gen_qemu_ld64(s, cpu_avrh[rD(s->opcode)], EA); \
-        } else {                                           \
-            gen_qemu_ld64(s, cpu_avrh[rD(s->opcode)], EA); \
-            tcg_gen_addi_tl(EA, EA, 8);                    \
-            gen_qemu_ld64(s, cpu_avrl[rD(s->opcode)], EA); \
-        }                                                  \
-        tcg_temp_free(EA);                                 \
-    }
-
-#define GEN_VR_STX(name, opc2, opc3)                       \
-    static void gen_st##name(DisasContext *s)              \
-    {                                                      \
-        TCGv EA;                                           \
-        if(unlikely(!s->altivec_enabled)) {                \
-            gen_exception(s, POWERPC_EXCP_VPU);            \
-            return;                                        \
-        }                                                  \
-        gen_set_access_type(s, ACCESS_INT);                \
-        EA = tcg_temp_local_new();                         \
-        gen_addr_reg_index(s, EA);                         \
-        tcg_gen_andi_tl(EA, EA, ~0xf);                     \
-        if(s->le_mode) {                                   \
-            gen_qemu_st64(s, cpu_avrl[rD(s->opcode)], EA); \
-            tcg_gen_addi_tl(EA, EA, 8);                    \
-            gen_qemu_st64(s, cpu_avrh[rD(s->opcode)], EA); \
-        } else {                                           \
-            gen_qemu_st64(s, cpu_avrh[rD(s->opcode)], EA); \
-            tcg_gen_addi_tl(EA, EA, 8);                    \
-            gen_qemu_st64(s, cpu_avrl[rD(s->opcode)], EA); \
-        }                                                  \
-        tcg_temp_free(EA);                                 \
+/* AVRs are not TCG globals, so that the gvec operations working on
+   CPUState directly and the code below see the same values.  */
+static inline int avr_full_offset(int reg)
+{
+    return offsetof(CPUState, avr[reg]);
+}
+
+static inline int avr64_offset(int reg, bool high)
+{
+#ifdef HOST_WORDS_BIGENDIAN
+    return offsetof(CPUState, avr[reg].u64[high ? 0 : 1]);
+#else
+    return offsetof(CPUState, avr[reg].u64[high ? 1 : 0]);
+#endif
+}
+
+/* Element numbers are big-endian, as in the instruction encodings.  */
+static inline int avr_element_offset(int reg, int vece, int element)
+{
+    int ofs = element << vece;
+#ifndef HOST_WORDS_BIGENDIAN
+    ofs = sizeof(ppc_avr_t) - (1 << vece) - ofs;
+#endif
+    return avr_full_offset(reg) + ofs;
+}
+
+static inline void get_avr64(TCGv_i64 dst, int reg, bool high)
+{
+    tcg_gen_ld_i64(dst, cpu_env, avr64_offset(reg, high));
+}
+
+static inline void set_avr64(int reg, TCGv_i64 src, bool high)
+{
+    tcg_gen_st_i64(src, cpu_env, avr64_offset(reg, high));
+}
+
+#define GEN_VR_LDX(name, opc2, opc3)                         \
+    static void glue(gen_, name)(DisasContext * s)           \
+    {                                                        \
+        TCGv EA;                                             \
+        TCGv_i64 avr;                                        \
+        if(unlikely(!s->altivec_enabled)) {                  \
+            gen_exception(s, POWERPC_EXCP_VPU);              \
+            return;                                          \
+        }                                                    \
+        gen_set_access_type(s, ACCESS_INT);                  \
+        EA = tcg_temp_new();                                 \
+        avr = tcg_temp_new_i64();                            \
+        gen_addr_reg_index(s, EA);                           \
+        tcg_gen_andi_tl(EA, EA, ~0xf);                       \
+        gen_qemu_ld64(s, avr, EA);                           \
+        set_avr64(rD(s->opcode), avr, !s->le_mode);          \
+        tcg_gen_addi_tl(EA, EA, 8);                          \
+        gen_qemu_ld64(s, avr, EA);                           \
+        set_avr64(rD(s->opcode), avr, s->le_mode);           \
+        tcg_temp_free_i64(avr);                              \
+        tcg_temp_free(EA);                                   \
+    }
+
+#define GEN_VR_STX(name, opc2, opc3)                         \
+    static void gen_st##name(DisasContext *s)                \
+    {                                                        \
+        TCGv EA;                                             \
+        TCGv_i64 avr;                                        \
+        if(unlikely(!s->altivec_enabled)) {                  \
+            gen_exception(s, POWERPC_EXCP_VPU);              \
+            return;                                          \
+        }                                                    \
+        gen_set_access_type(s, ACCESS_INT);                  \
+        EA = tcg_temp_local_new();                           \
+        avr = tcg_temp_local_new_i64();                      \
+        gen_addr_reg_index(s, EA);                           \
+        tcg_gen_andi_tl(EA, EA, ~0xf);                       \
+        get_avr64(avr, rD(s->opcode), !s->le_mode);          \
+        gen_qemu_st64(s, avr, EA);                           \
+        tcg_gen_addi_tl(EA, EA, 8);                          \
+        get_avr64(avr, rD(s->opcode), s->le_mode);           \
+        gen_qemu_st64(s, avr, EA);                           \
+        tcg_temp_free_i64(avr);                              \
+        tcg_temp_free(EA);                                   \
     }
 
 #define GEN_VR_LVE(name, opc2, opc3)            \
@@ -5916,16 +5940,21 @@ static void gen_lvsr(DisasContext *s)
 
 static void gen_mfvscr(DisasContext *s)
 {
+    TCGv_i64 avr;
     TCGv_i32 t;
     if(unlikely(!s->altivec_enabled)) {
         gen_exception(s, POWERPC_EXCP_VPU);
         return;
     }
-    tcg_gen_movi_i64(cpu_avrh[rD(s->opcode)], 0);
+    avr = tcg_temp_new_i64();
+    tcg_gen_movi_i64(avr, 0);
+    set_avr64(rD(s->opcode), avr, true);
     t = tcg_temp_new_i32();
     tcg_gen_ld_i32(t, cpu_env, offsetof(CPUState, vscr));
-    tcg_gen_extu_i32_i64(cpu_avrl[rD(s->opcode)], t);
+    tcg_gen_extu_i32_i64(avr, t);
+    set_avr64(rD(s->opcode), avr, false);
     tcg_temp_free_i32(t);
+    tcg_temp_free_i64(avr);
 }
 
 static void gen_mtvscr(DisasContext *s)
@@ -5940,23 +5969,26 @@ static void gen_mtvscr(DisasContext *s)
     tcg_temp_free_ptr(p);
 }
 
-/* Logical operations */
-#define GEN_VX_LOGICAL(name, tcg_op, opc2, opc3)                                           \
-    static void glue(gen_, name)(DisasContext * s)                                         \
-    {                                                                                      \
-        if(unlikely(!s->altivec_enabled)) {                                                \
-            gen_exception(s, POWERPC_EXCP_VPU);                                            \
-            return;                                                                        \
-        }                                                                                  \
-        tcg_op(cpu_avrh[rD(s->opcode)], cpu_avrh[rA(s->opcode)], cpu_avrh[rB(s->opcode)]); \
-        tcg_op(cpu_avrl[rD(s->opcode)], cpu_avrl[rA(s->opcode)], cpu_avrl[rB(s->opcode)]); \
+/* Lane-wise operations expanded with the generic vector operations */
+#define GEN_VXFORM_V(name, vece, tcg_op, opc2, opc3)                                                                 \
+    static void glue(gen_, name)(DisasContext * s)                                                                   \
+    {                                                                                                                \
+        if(unlikely(!s->altivec_enabled)) {                                                                          \
+            gen_exception(s, POWERPC_EXCP_VPU);                                                                      \
+            return;                                                                                                  \
+        }                                                                                                            \
+        tcg_op(vece, avr_full_offset(rD(s->opcode)), avr_full_offset(rA(s->opcode)), avr_full_offset(rB(s->opcode)), \
+               sizeof(ppc_avr_t), sizeof(ppc_avr_t));                                                                \
     }
 
-GEN_VX_LOGICAL(vand, tcg_gen_and_i64, 2, 16);
-GEN_VX_LOGICAL(vandc, tcg_gen_andc_i64, 2, 17);
-GEN_VX_LOGICAL(vor, tcg_gen_or_i64, 2, 18);
-GEN_VX_LOGICAL(vxor, tcg_gen_xor_i64, 2, 19);
-GEN_VX_LOGICAL(vnor, tcg_gen_nor_i64, 2, 20);
+/* Logical operations */
+#define GEN_VX_LOGICAL(name, tcg_op, opc2, opc3) GEN_VXFORM_V(name, MO_64, tcg_op, opc2, opc3)
+
+GEN_VX_LOGICAL(vand, tcg_gen_gvec_and, 2, 16);
+GEN_VX_LOGICAL(vandc, tcg_gen_gvec_andc, 2, 17);
+GEN_VX_LOGICAL(vor, tcg_gen_gvec_or, 2, 18);
+GEN_VX_LOGICAL(vxor, tcg_gen_gvec_xor, 2, 19);
+GEN_VX_LOGICAL(vnor, tcg_gen_gvec_nor, 2, 20);
 
 #define GEN_VXFORM(name, opc2, opc3)               \
     static void glue(gen_, name)(DisasContext * s) \
@@ -5975,24 +6007,24 @@ GEN_VX_LOGICAL(vnor, tcg_gen_nor_i64, 2, 20);
         tcg_temp_free_ptr(rd);                     \
     }
 
-GEN_VXFORM(vaddubm, 0, 0);
-GEN_VXFORM(vadduhm, 0, 1);
-GEN_VXFORM(vadduwm, 0, 2);
-GEN_VXFORM(vsububm, 0, 16);
-GEN_VXFORM(vsubuhm, 0, 17);
-GEN_VXFORM(vsubuwm, 0, 18);
-GEN_VXFORM(vmaxub, 1, 0);
-GEN_VXFORM(vmaxuh, 1, 1);
-GEN_VXFORM(vmaxuw, 1, 2);
-GEN_VXFORM(vmaxsb, 1, 4);
-GEN_VXFORM(vmaxsh, 1, 5);
-GEN_VXFORM(vmaxsw, 1, 6);
-GEN_VXFORM(vminub, 1, 8);
-GEN_VXFORM(vminuh, 1, 9);
-GEN_VXFORM(vminuw, 1, 10);
-GEN_VXFORM(vminsb, 1, 12);
-GEN_VXFORM(vminsh, 1, 13);
-GEN_VXFORM(vminsw, 1, 14);
+GEN_VXFORM_V(vaddubm, MO_8, tcg_gen_gvec_add, 0, 0);
+GEN_VXFORM_V(vadduhm, MO_16, tcg_gen_gvec_add, 0, 1);
+GEN_VXFORM_V(vadduwm, MO_32, tcg_gen_gvec_add, 0, 2);
+GEN_VXFORM_V(vsububm, MO_8, tcg_gen_gvec_sub, 0, 16);
+GEN_VXFORM_V(vsubuhm, MO_16, tcg_gen_gvec_sub, 0, 17);
+GEN_VXFORM_V(vsubuwm, MO_32, tcg_gen_gvec_sub, 0, 18);
+GEN_VXFORM_V(vmaxub, MO_8, tcg_gen_gvec_umax, 1, 0);
+GEN_VXFORM_V(vmaxuh, MO_16, tcg_gen_gvec_umax, 1, 1);
+GEN_VXFORM_V(vmaxuw, MO_32, tcg_gen_gvec_umax, 1, 2);
+GEN_VXFORM_V(vmaxsb, MO_8, tcg_gen_gvec_smax, 1, 4);
+GEN_VXFORM_V(vmaxsh, MO_16, tcg_gen_gvec_smax, 1, 5);
+GEN_VXFORM_V(vmaxsw, MO_32, tcg_gen_gvec_smax, 1, 6);
+GEN_VXFORM_V(vminub, MO_8, tcg_gen_gvec_umin, 1, 8);
+GEN_VXFORM_V(vminuh, MO_16, tcg_gen_gvec_umin, 1, 9);
+GEN_VXFORM_V(vminuw, MO_32, tcg_gen_gvec_umin, 1, 10);
+GEN_VXFORM_V(vminsb, MO_8, tcg_gen_gvec_smin, 1, 12);
+GEN_VXFORM_V(vminsh, MO_16, tcg_gen_gvec_smin, 1, 13);
+GEN_VXFORM_V(vminsw, MO_32, tcg_gen_gvec_smin, 1, 14);
 GEN_VXFORM(vavgub, 1, 16);
 GEN_VXFORM(vavguh, 1, 17);
 GEN_VXFORM(vavguw, 1, 18);
@@ -6013,15 +6045,15 @@ GEN_VXFORM(vmuleub, 4, 8);
 GEN_VXFORM(vmuleuh, 4, 9);
 GEN_VXFORM(vmulesb, 4, 12);
 GEN_VXFORM(vmulesh, 4, 13);
-GEN_VXFORM(vslb, 2, 4);
-GEN_VXFORM(vslh, 2, 5);
-GEN_VXFORM(vslw, 2, 6);
-GEN_VXFORM(vsrb, 2, 8);
-GEN_VXFORM(vsrh, 2, 9);
-GEN_VXFORM(vsrw, 2, 10);
-GEN_VXFORM(vsrab, 2, 12);
-GEN_VXFORM(vsrah, 2, 13);
-GEN_VXFORM(vsraw, 2, 14);
+GEN_VXFORM_V(vslb, MO_8, tcg_gen_gvec_shlv, 2, 4);
+GEN_VXFORM_V(vslh, MO_16, tcg_gen_gvec_shlv, 2, 5);
+GEN_VXFORM_V(vslw, MO_32, tcg_gen_gvec_shlv, 2, 6);
+GEN_VXFORM_V(vsrb, MO_8, tcg_gen_gvec_shrv, 2, 8);
+GEN_VXFORM_V(vsrh, MO_16, tcg_gen_gvec_shrv, 2, 9);
+GEN_VXFORM_V(vsrw, MO_32, tcg_gen_gvec_shrv, 2, 10);
+GEN_VXFORM_V(vsrab, MO_8, tcg_gen_gvec_sarv, 2, 12);
+GEN_VXFORM_V(vsrah, MO_16, tcg_gen_gvec_sarv, 2, 13);
+GEN_VXFORM_V(vsraw, MO_32, tcg_gen_gvec_sarv, 2, 14);
 GEN_VXFORM(vslo, 6, 16);
 GEN_VXFORM(vsro, 6, 17);
 GEN_VXFORM(vaddcuw, 0, 6);
@@ -6038,9 +6070,9 @@ GEN_VXFORM(vsubuws, 0, 26);
 GEN_VXFORM(vsubsbs, 0, 28);
 GEN_VXFORM(vsubshs, 0, 29);
 GEN_VXFORM(vsubsws, 0, 30);
-GEN_VXFORM(vrlb, 2, 0);
-GEN_VXFORM(vrlh, 2, 1);
-GEN_VXFORM(vrlw, 2, 2);
+GEN_VXFORM_V(vrlb, MO_8, tcg_gen_gvec_rotlv, 2, 0);
+GEN_VXFORM_V(vrlh, MO_16, tcg_gen_gvec_rotlv, 2, 1);
+GEN_VXFORM_V(vrlw, MO_32, tcg_gen_gvec_rotlv, 2, 2);
 GEN_VXFORM(vsl, 2, 7);
 GEN_VXFORM(vsr, 2, 11);
 GEN_VXFORM(vpkuhum, 7, 0);
@@ -6083,15 +6115,28 @@ GEN_VXFORM(vminfp, 5, 17);
     GEN_VXRFORM1(name, name, #name, opc2, opc3) \
     GEN_VXRFORM1(name##_dot, name##_, #name ".", opc2, (opc3 | (0x1 << 4)))
 
-GEN_VXRFORM(vcmpequb, 3, 0)
-GEN_VXRFORM(vcmpequh, 3, 1)
-GEN_VXRFORM(vcmpequw, 3, 2)
-GEN_VXRFORM(vcmpgtsb, 3, 12)
-GEN_VXRFORM(vcmpgtsh, 3, 13)
-GEN_VXRFORM(vcmpgtsw, 3, 14)
-GEN_VXRFORM(vcmpgtub, 3, 8)
-GEN_VXRFORM(vcmpgtuh, 3, 9)
-GEN_VXRFORM(vcmpgtuw, 3, 10)
+/* Only the record forms, which also update CR6, need the helpers */
+#define GEN_VXRFORM_V(name, vece, cond, opc2, opc3)                                                  \
+    static void glue(gen_, name)(DisasContext * s)                                                   \
+    {                                                                                                \
+        if(unlikely(!s->altivec_enabled)) {                                                          \
+            gen_exception(s, POWERPC_EXCP_VPU);                                                      \
+            return;                                                                                  \
+        }                                                                                            \
+        tcg_gen_gvec_cmp(cond, vece, avr_full_offset(rD(s->opcode)), avr_full_offset(rA(s->opcode)), \
+                         avr_full_offset(rB(s->opcode)), sizeof(ppc_avr_t), sizeof(ppc_avr_t));      \
+    }                                                                                                \
+    GEN_VXRFORM1(name##_dot, name##_, #name ".", opc2, (opc3 | (0x1 << 4)))
+
+GEN_VXRFORM_V(vcmpequb, MO_8, TCG_COND_EQ, 3, 0)
+GEN_VXRFORM_V(vcmpequh, MO_16, TCG_COND_EQ, 3, 1)
+GEN_VXRFORM_V(vcmpequw, MO_32, TCG_COND_EQ, 3, 2)
+GEN_VXRFORM_V(vcmpgtsb, MO_8, TCG_COND_GT, 3, 12)
+GEN_VXRFORM_V(vcmpgtsh, MO_16, TCG_COND_GT, 3, 13)
+GEN_VXRFORM_V(vcmpgtsw, MO_32, TCG_COND_GT, 3, 14)
+GEN_VXRFORM_V(vcmpgtub, MO_8, TCG_COND_GTU, 3, 8)
+GEN_VXRFORM_V(vcmpgtuh, MO_16, TCG_COND_GTU, 3, 9)
+GEN_VXRFORM_V(vcmpgtuw, MO_32, TCG_COND_GTU, 3, 10)
 GEN_VXRFORM(vcmpeqfp, 3, 3)
 GEN_VXRFORM(vcmpgefp, 3, 7)
 GEN_VXRFORM(vcmpgtfp, 3, 11)
@@ -6113,9 +6158,20 @@ GEN_VXRFORM(vcmpbfp, 3, 15)
         tcg_temp_free_ptr(rd);                     \
     }
 
-GEN_VXFORM_SIMM(vspltisb, 6, 12);
-GEN_VXFORM_SIMM(vspltish, 6, 13);
-GEN_VXFORM_SIMM(vspltisw, 6, 14);
+#define GEN_VXFORM_DUPI(name, vece, opc2, opc3)                                                          \
+    static void glue(gen_, name)(DisasContext * s)                                                       \
+    {                                                                                                    \
+        if(unlikely(!s->altivec_enabled)) {                                                              \
+            gen_exception(s, POWERPC_EXCP_VPU);                                                          \
+            return;                                                                                      \
+        }                                                                                                \
+        tcg_gen_gvec_dup_imm(vece, avr_full_offset(rD(s->opcode)), sizeof(ppc_avr_t), sizeof(ppc_avr_t), \
+                             sextract32(SIMM5(s->opcode), 0, 5));                                        \
+    }
+
+GEN_VXFORM_DUPI(vspltisb, MO_8, 6, 12);
+GEN_VXFORM_DUPI(vspltish, MO_16, 6, 13);
+GEN_VXFORM_DUPI(vspltisw, MO_32, 6, 14);
 
 #define GEN_VXFORM_NOA(name, opc2, opc3)           \
     static void glue(gen_, name)(DisasContext * s) \
@@ -6181,9 +6237,23 @@ GEN_VXFORM_NOA(vrfiz, 5, 11);
         tcg_temp_free_ptr(rd);                     \
     }
 
-GEN_VXFORM_UIMM(vspltb, 6, 8);
-GEN_VXFORM_UIMM(vsplth, 6, 9);
-GEN_VXFORM_UIMM(vspltw, 6, 10);
+/* Experimental testing shows that hardware masks the immediate.  */
+#define GEN_VXFORM_DUP(name, vece, opc2, opc3)                                                                       \
+    static void glue(gen_, name)(DisasContext * s)                                                                   \
+    {                                                                                                                \
+        int element;                                                                                                 \
+        if(unlikely(!s->altivec_enabled)) {                                                                          \
+            gen_exception(s, POWERPC_EXCP_VPU);                                                                      \
+            return;                                                                                                  \
+        }                                                                                                            \
+        element = UIMM5(s->opcode) & ((sizeof(ppc_avr_t) >> (vece)) - 1);                                            \
+        tcg_gen_gvec_dup_mem(vece, avr_full_offset(rD(s->opcode)), avr_element_offset(rB(s->opcode), vece, element), \
+                             sizeof(ppc_avr_t), sizeof(ppc_avr_t));                                                  \
+    }
+
+GEN_VXFORM_DUP(vspltb, MO_8, 6, 8);
+GEN_VXFORM_DUP(vsplth, MO_16, 6, 9);
+GEN_VXFORM_DUP(vspltw, MO_32, 6, 10);
 GEN_VXFORM_UIMM(vcfux, 5, 12);
 GEN_VXFORM_UIMM(vcfsx, 5, 13);
 GEN_VXFORM_UIMM(vctuxs, 5, 14);
@@ -8194,24 +8264,24 @@ GEN_PPC64_R4(rldimi, 0x1E, 0x06),
 #undef GEN_FLOAT_AC
 #undef GEN_FLOAT_B
 #undef GEN_FLOAT_BS
-#define _GEN_FLOAT_ACB(name, op, op1, op2, isfloat, set_fprf, type)           \
+#define _GEN_FLOAT_ACB(name, op, op1, op2, isfloat, set_fprf, type) \
 GEN_HANDLER(f##name, op1, op2, 0xFF, 0x00000000, type)
 #define GEN_FLOAT_ACB(name, op2, set_fprf, type)                              \
 _GEN_FLOAT_ACB(name, name, 0x3F, op2, 0, set_fprf, type),                     \
 _GEN_FLOAT_ACB(name##s, name, 0x3B, op2, 1, set_fprf, type)
-#define _GEN_FLOAT_AB(name, op, op1, op2, inval, isfloat, set_fprf, type)     \
+#define _GEN_FLOAT_AB(name, op, op1, op2, inval, isfloat, set_fprf, type) \
 GEN_HANDLER(f##name, op1, op2, 0xFF, inval, type)
 #define GEN_FLOAT_AB(name, op2, inval, set_fprf, type)                        \
 _GEN_FLOAT_AB(name, name, 0x3F, op2, inval, 0, set_fprf, type),               \
 _GEN_FLOAT_AB(name##s, name, 0x3B, op2, inval, 1, set_fprf, type)
-#define _GEN_FLOAT_AC(name, op, op1, op2, inval, isfloat, set_fprf, type)     \
+#define _GEN_FLOAT_AC(name, op, op1, op2, inval, isfloat, set_fprf, type) \
 GEN_HANDLER(f##name, op1, op2, 0xFF, inval, type)
 #define GEN_FLOAT_AC(name, op2, inval, set_fprf, type)                        \
 _GEN_FLOAT_AC(name, name, 0x3F, op2, inval, 0, set_fprf, type),               \
 _GEN_FLOAT_AC(name##s, name, 0x3B, op2, inval, 1, set_fprf, type)
 #define GEN_FLOAT_B(name, op2, op3, set_fprf, type)                           \
 GEN_HANDLER(f##name, 0x3F, op2, op3, 0x001F0000, type)
-#define GEN_FLOAT_BS(name, op1, op2, set_fprf, type)                          \
+#define GEN_FLOAT_BS(name, op1, op2, set_fprf, type) \
 GEN_HANDLER(f##name, op1, op2, 0xFF, 0x001F07C0, type)
 
 GEN_FLOAT_AB(add, 0x15, 0x000007C0, 1, PPC_FLOAT),
@@ -8432,11 +8502,11 @@ GEN_VR_STVE(wx, 0x07, 0x06),
 #undef GEN_VX_LOGICAL
 #define GEN_VX_LOGICAL(name, tcg_op, opc2, opc3)                              \
 GEN_HANDLER(name, 0x04, opc2, opc3, 0x00000000, PPC_ALTIVEC)
-GEN_VX_LOGICAL(vand, tcg_gen_and_i64, 2, 16),
-GEN_VX_LOGICAL(vandc, tcg_gen_andc_i64, 2, 17),
-GEN_VX_LOGICAL(vor, tcg_gen_or_i64, 2, 18),
-GEN_VX_LOGICAL(vxor, tcg_gen_xor_i64, 2, 19),
-GEN_VX_LOGICAL(vnor, tcg_gen_nor_i64, 2, 20),
+GEN_VX_LOGICAL(vand, tcg_gen_gvec_and, 2, 16),
+GEN_VX_LOGICAL(vandc, tcg_gen_gvec_andc, 2, 17),
+GEN_VX_LOGICAL(vor, tcg_gen_gvec_or, 2, 18),
+GEN_VX_LOGICAL(vxor, tcg_gen_gvec_xor, 2, 19),
+GEN_VX_LOGICAL(vnor, tcg_gen_gvec_nor, 2, 20),
 
 #undef GEN_VXFORM
 #define GEN_VXFORM(name, opc2, opc3)                                          \
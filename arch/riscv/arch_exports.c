@@ -251,6 +251,8 @@ int32_t tlib_install_custom_csr(uint16_t id)
     int slotOffset = id % CSRS_PER_SLOT;
 
     cpu->custom_csrs[slotId] |= (1 << slotOffset);
+    //  Reads of some counter CSRs are translated inline, drop them so the custom implementation takes over
+    tb_flush(cpu);
 
     return 0;
 }
@@ -323,6 +325,30 @@ void tlib_set_csr_validation_level(uint32_t value)
 
 EXC_VOID_1(tlib_set_csr_validation_level, uint32_t, value)
 
+/*
+ * Makes the `time` CSR advance linearly with the executed instructions, starting from `time` at the current
+ * instruction count, at a rate of `ticks_per_instruction` given as a 32.32 fixed-point number.
+ * Reads of `time` are then served by tlib without calling `tlib_get_cpu_time`. The host is expected to call it again
+ * at synchronization points to correct the drift.
+ */
+void tlib_set_linear_time_source(uint64_t time, uint64_t ticks_per_instruction)
+{
+    cpu->time_source_linear = true;
+    cpu->time_base = time;
+    cpu->time_base_instructions = cpu->instructions_count_total_value;
+    cpu->time_ticks_per_instruction = ticks_per_instruction;
+}
+
+EXC_VOID_2(tlib_set_linear_time_source, uint64_t, time, uint64_t, ticks_per_instruction)
+
+//  Goes back to calling `tlib_get_cpu_time` on every read of the `time` CSR, for non-linear time sources
+void tlib_clear_linear_time_source()
+{
+    cpu->time_source_linear = false;
+}
+
+EXC_VOID_0(tlib_clear_linear_time_source)
+
 uint32_t tlib_get_csr_validation_level()
 {
     return cpu->csr_validation_level;
@@ -482,6 +508,7 @@ void tlib_set_pmp_entry_count(uint32_t entry_count)
         return;
     }
     cpu->pmp_entry_count = entry_count;
+    cpu->pmp_state.segments_valid = false;
 }
 
 EXC_VOID_1(tlib_set_pmp_entry_count, uint32_t, max_entry_count)
@@ -491,6 +518,7 @@ void tlib_set_pmpaddr(uint32_t index, uint64_t start_address, uint64_t end_addre
     if(index < cpu->pmp_entry_count) {
         cpu->pmp_state.addr[index].sa = start_address & cpu->pmp_addr_mask;
         cpu->pmp_state.addr[index].ea = end_address & cpu->pmp_addr_mask;
+        cpu->pmp_state.segments_valid = false;
     } else {
         tlib_printf(LOG_LEVEL_ERROR, "Tried to set the address of PMP entry %u but the maximum index is %u, write ignored", index,
                     cpu->pmp_entry_count - 1);
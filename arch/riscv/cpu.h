@@ -180,6 +180,12 @@ struct CPUState {
     uint64_t minstret_snapshot_offset;
     uint64_t minstret_snapshot;
 
+    /* `time` CSR extrapolated from the executed instructions, set up by the host with tlib_set_linear_time_source */
+    bool time_source_linear;
+    uint64_t time_base;
+    uint64_t time_base_instructions;
+    uint64_t time_ticks_per_instruction; /* 32.32 fixed point */
+
     /* non maskable interrupts */
     uint32_t nmi_pending;
     target_ulong nmi_address;
@@ -279,6 +285,15 @@ static inline bool cpu_has_work(CPUState *env)
     return !env->wfi;
 }
 
+//  Value of the `time` CSR while it is extrapolated from the executed instructions, see `tlib_set_linear_time_source`
+static inline uint64_t cpu_riscv_linear_time(CPUState *env)
+{
+    //  Keep in sync with `gen_counter_csr_read` in translate.c
+    uint64_t low, high;
+    mulu64(&low, &high, env->instructions_count_total_value - env->time_base_instructions, env->time_ticks_per_instruction);
+    return env->time_base + ((high << 32) | (low >> 32));
+}
+
 static inline int riscv_mstatus_fs(CPUState *env)
 {
     return env->mstatus & MSTATUS_FS;
@@ -304,6 +319,8 @@ void cpu_reset_nmi(CPUState *env, int number);
 
 void csr_write_helper(CPUState *env, target_ulong val_to_write, target_ulong csrno);
 
+uint32_t has_custom_csr(CPUState *env, uint64_t id);
+
 void do_nmi(CPUState *env);
 
 static inline void cpu_pc_from_tb(CPUState *cs, TranslationBlock *tb)
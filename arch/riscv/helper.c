@@ -45,6 +45,10 @@ void cpu_reset(CPUState *env)
     memcpy(custom_csrs, env->custom_csrs, sizeof(uint64_t) * CSRS_SLOTS);
     target_ulong vlenb = env->vlenb;
     target_ulong elen = env->elen;
+    bool time_source_linear = env->time_source_linear;
+    //  The instruction counter is cleared below, so the linear time source is rebased to keep `time` continuous
+    uint64_t time_base = time_source_linear ? cpu_riscv_linear_time(env) : env->time_base;
+    uint64_t time_ticks_per_instruction = env->time_ticks_per_instruction;
 
     memset(env, 0, RESET_OFFSET);
 
@@ -69,6 +73,10 @@ void cpu_reset(CPUState *env)
     memcpy(env->custom_instructions, custom_instructions,
            sizeof(custom_instruction_descriptor_t) * CPU_CUSTOM_INSTRUCTIONS_LIMIT);
     memcpy(env->custom_csrs, custom_csrs, sizeof(uint64_t) * CSRS_SLOTS);
+    env->time_source_linear = time_source_linear;
+    env->time_base = time_base;
+    env->time_base_instructions = 0;
+    env->time_ticks_per_instruction = time_ticks_per_instruction;
     env->pmp_napot_grain = -1;
     env->tb_broadcast_dirty = false;
 
@@ -448,7 +456,6 @@ int cpu_handle_mmu_fault(CPUState *env, target_ulong address, int access_type, i
     int prot;
     int pmp_prot;
     int pmp_access_type = 1 << access_type;
-    int overlapping_region_id;
     int ret = TRANSLATE_FAIL;
     target_ulong page_size = TARGET_PAGE_SIZE;
 
@@ -459,21 +466,15 @@ int cpu_handle_mmu_fault(CPUState *env, target_ulong address, int access_type, i
     }
     if(ret == TRANSLATE_SUCCESS) {
         *paddr = pa;
-        overlapping_region_id = pmp_find_overlapping(env, pa & TARGET_PAGE_MASK, TARGET_PAGE_SIZE, 0);
-
-        //  are there any PMP regions defined for this page?
-        if(overlapping_region_id != -1) {
-            //  does the PMP region cover only a part of the page?
-            if(env->pmp_state.addr[overlapping_region_id].sa > (pa & TARGET_PAGE_MASK) ||
-               env->pmp_state.addr[overlapping_region_id].ea < (pa & TARGET_PAGE_MASK) + TARGET_PAGE_SIZE - 1) {
-                //  this effectively makes the tlb page entry one-shot:
-                //  thanks to this every access to this page will be verified against PMP
-                page_size = access_width;
-            } else {
-                //  PMP region covers the entire page, we can safely propagate restrictions
-                //  to the page level (PAGE_xxxx follows the same notation as PMP_xxxx)
-                prot &= pmp_prot;
-            }
+        //  is every access to this page decided by the same PMP rule?
+        if(!pmp_is_page_uniform(env, pa & TARGET_PAGE_MASK)) {
+            //  this effectively makes the tlb page entry one-shot:
+            //  thanks to this every access to this page will be verified against PMP
+            page_size = access_width;
+        } else {
+            //  we can safely propagate restrictions to the page level
+            //  (PAGE_xxxx follows the same notation as PMP_xxxx)
+            prot &= pmp_prot;
         }
 
         tlb_set_page(env, address & TARGET_PAGE_MASK, pa & TARGET_PAGE_MASK, prot, mmu_idx, page_size);
@@ -158,6 +158,14 @@ static inline uint64_t cpu_riscv_read_instret(CPUState *env)
     return retval;
 }
 
+static inline uint64_t cpu_riscv_read_time(CPUState *env)
+{
+    if(!env->time_source_linear) {
+        return tlib_get_cpu_time();
+    }
+    return cpu_riscv_linear_time(env);
+}
+
 /* Exceptions processing helpers */
 static inline void __attribute__((__noreturn__)) do_raise_exception_err(CPUState *env, uint32_t exception, uintptr_t pc,
                                                                         uint32_t call_hook)
@@ -881,10 +889,10 @@ static inline target_ulong csr_read_helper(CPUState *env, target_ulong csrno)
             }
             return env->jvt;
         case CSR_TIME:
-            return tlib_get_cpu_time();
+            return cpu_riscv_read_time(env);
         case CSR_TIMEH:
 #if defined(TARGET_RISCV32)
-            return tlib_get_cpu_time() >> 32;
+            return cpu_riscv_read_time(env) >> 32;
 #endif
             break;
         case CSR_INSTRET:
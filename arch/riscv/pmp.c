@@ -240,6 +240,7 @@ static void pmp_update_rule(CPUState *env, uint32_t pmp_index)
 
     env->pmp_state.addr[pmp_index].sa = sa & cpu->pmp_addr_mask;
     env->pmp_state.addr[pmp_index].ea = ea & cpu->pmp_addr_mask;
+    env->pmp_state.segments_valid = false;
 
     for(i = 0; i < env->pmp_entry_count; i++) {
         const uint8_t a_field = pmp_get_a_field(env->pmp_state.pmp[i].cfg_reg);
@@ -265,42 +266,150 @@ static int pmp_is_in_range(CPUState *env, int pmp_index, target_ulong addr)
     return result;
 }
 
+static inline bool pmp_is_rule_active(CPUState *env, int pmp_index)
+{
+    return pmp_get_a_field(env->pmp_state.pmp[pmp_index].cfg_reg) != PMP_AMATCH_OFF &&
+           env->pmp_state.addr[pmp_index].sa <= env->pmp_state.addr[pmp_index].ea;
+}
+
+static int pmp_compare_bounds(const void *a, const void *b)
+{
+    target_ulong x = *(const target_ulong *)a;
+    target_ulong y = *(const target_ulong *)b;
+
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
 /*
- * Public Interface
+ * Flatten the active rules into a sorted list of segments, each tagged with the
+ * highest-priority rule matching every address inside it. Neighbouring segments
+ * decided by the same rule are merged, so an access (or a page) that fits in
+ * a single segment is decided by that segment's rule alone.
+ */
+static void pmp_rebuild_segments(CPUState *env)
+{
+    target_ulong bounds[2 * MAX_RISCV_PMPS + 1];
+    pmp_segment_t *segments = env->pmp_state.segments;
+    uint32_t num_bounds = 0;
+    uint32_t num_segments = 0;
+    int i, j;
+
+    bounds[num_bounds++] = 0;
+    for(i = 0; i < env->pmp_entry_count; i++) {
+        if(!pmp_is_rule_active(env, i)) {
+            continue;
+        }
+        bounds[num_bounds++] = env->pmp_state.addr[i].sa;
+        if(env->pmp_state.addr[i].ea != (target_ulong)-1) {
+            bounds[num_bounds++] = env->pmp_state.addr[i].ea + 1;
+        }
+    }
+    qsort(bounds, num_bounds, sizeof(bounds[0]), pmp_compare_bounds);
+
+    for(j = 0; j < num_bounds; j++) {
+        int32_t rule = -1;
+
+        if(j > 0 && bounds[j] == bounds[j - 1]) {
+            continue;
+        }
+        //  No rule starts or ends inside a segment, so checking its first address is enough
+        for(i = 0; i < env->pmp_entry_count; i++) {
+            if(pmp_is_rule_active(env, i) && env->pmp_state.addr[i].sa <= bounds[j] && env->pmp_state.addr[i].ea >= bounds[j]) {
+                rule = i;
+                break;
+            }
+        }
+        if(num_segments > 0 && segments[num_segments - 1].rule == rule) {
+            continue;
+        }
+        segments[num_segments].start = bounds[j];
+        segments[num_segments].rule = rule;
+        num_segments++;
+    }
+
+    env->pmp_state.num_segments = num_segments;
+    env->pmp_state.segments_valid = true;
+}
+
+/*
+ * Find the index of the segment containing the (already masked) address
  */
+static uint32_t pmp_find_segment(CPUState *env, target_ulong addr)
+{
+    uint32_t low = 0;
+    uint32_t high;
+
+    if(unlikely(!env->pmp_state.segments_valid)) {
+        pmp_rebuild_segments(env);
+    }
 
-int pmp_find_overlapping(CPUState *env, target_ulong addr, target_ulong size, int starting_index)
+    //  The first segment always starts at 0, so there is always a match
+    high = env->pmp_state.num_segments - 1;
+    while(low < high) {
+        uint32_t mid = (low + high + 1) / 2;
+        if(env->pmp_state.segments[mid].start <= addr) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+static inline target_ulong pmp_segment_end(CPUState *env, uint32_t segment_index)
+{
+    if(segment_index + 1 >= env->pmp_state.num_segments) {
+        return (target_ulong)-1;
+    }
+    return env->pmp_state.segments[segment_index + 1].start - 1;
+}
+
+#define PMP_NO_MATCH      -1
+#define PMP_PARTIAL_MATCH -2
+
+/*
+ * Find the highest-priority rule matching the access. Returns PMP_PARTIAL_MATCH
+ * if that rule covers only a part of the access.
+ */
+static int pmp_match_rule(CPUState *env, target_ulong addr, target_ulong size)
 {
     int i;
-    target_ulong pmp_sa;
-    target_ulong pmp_ea;
-    addr &= cpu->pmp_addr_mask;
-    uint8_t a_field;
+    target_ulong s, e;
+    uint32_t segment = pmp_find_segment(env, addr);
+    target_ulong last = (addr + size - 1) & cpu->pmp_addr_mask;
 
-    if(unlikely(env->use_external_pmp)) {
-        return tlib_extpmp_find_overlapping(addr, size, starting_index);
+    if(last >= env->pmp_state.segments[segment].start && last <= pmp_segment_end(env, segment)) {
+        return env->pmp_state.segments[segment].rule;
     }
 
-    for(i = starting_index; i < env->pmp_entry_count; i++) {
-        a_field = pmp_get_a_field(env->pmp_state.pmp[i].cfg_reg);
+    /* The access crosses a segment boundary, so check the rules one by one.
+     * 1.10 draft priv spec states there is an implicit order from low to high */
+    for(i = 0; i < env->pmp_entry_count; i++) {
+        s = pmp_is_in_range(env, i, addr);
+        e = pmp_is_in_range(env, i, addr + size - 1);
+        const uint8_t a_field = pmp_get_a_field(env->pmp_state.pmp[i].cfg_reg);
         if(a_field == PMP_AMATCH_OFF) {
             continue;
         }
-        pmp_sa = env->pmp_state.addr[i].sa;
-        pmp_ea = env->pmp_state.addr[i].ea;
 
-        if(pmp_sa < addr) {
-            if(pmp_ea >= addr) {
-                return i;
-            }
-        } else if(pmp_sa <= addr + size - 1) {
+        /* partially inside */
+        if((s + e) == 1) {
+            PMP_DEBUG("pmp violation - access is partially in inside");
+            return PMP_PARTIAL_MATCH;
+        }
+
+        /* fully inside */
+        if((s + e) == 2) {
             return i;
         }
     }
-
-    return -1;
+    return PMP_NO_MATCH;
 }
 
+/*
+ * Public Interface
+ */
+
 /* Normal PMP rules behavior, without Smepmp
  * or with Machine Mode Lockdown (MSECCFG_MML) disabled */
 static inline pmp_priv_t pmp_get_privs_normal(int pmp_index, target_ulong priv)
@@ -373,10 +482,8 @@ static inline pmp_priv_t pmp_get_privs_mml(int pmp_index, target_ulong priv)
  */
 int pmp_get_access(CPUState *env, target_ulong addr, target_ulong size, int access_type)
 {
-    int i = 0;
+    int rule;
     int ret = -1;
-    target_ulong s = 0;
-    target_ulong e = 0;
     addr &= cpu->pmp_addr_mask;
 
     if(unlikely(env->use_external_pmp)) {
@@ -404,28 +511,11 @@ int pmp_get_access(CPUState *env, target_ulong addr, target_ulong size, int acce
         }
     }
 
-    /* 1.10 draft priv spec states there is an implicit order
-         from low to high */
-    for(i = 0; i < env->pmp_entry_count; i++) {
-        s = pmp_is_in_range(env, i, addr);
-        e = pmp_is_in_range(env, i, addr + size - 1);
-        const uint8_t a_field = pmp_get_a_field(env->pmp_state.pmp[i].cfg_reg);
-        if(a_field == PMP_AMATCH_OFF) {
-            continue;
-        }
-
-        /* partially inside */
-        if((s + e) == 1) {
-            PMP_DEBUG("pmp violation - access is partially in inside");
-            ret = 0;
-            break;
-        }
-
-        /* fully inside */
-        if((s + e) == 2) {
-            ret = (env->mseccfg & MSECCFG_MML) ? pmp_get_privs_mml(i, priv) : pmp_get_privs_normal(i, priv);
-            break;
-        }
+    rule = pmp_match_rule(env, addr, size);
+    if(rule == PMP_PARTIAL_MATCH) {
+        ret = 0;
+    } else if(rule != PMP_NO_MATCH) {
+        ret = (env->mseccfg & MSECCFG_MML) ? pmp_get_privs_mml(rule, priv) : pmp_get_privs_normal(rule, priv);
     }
 
     /* No rule matched */
@@ -598,3 +688,23 @@ bool pmp_is_any_region_locked(CPUState *env)
     }
     return false;
 }
+
+/*
+ * Check whether every access to the page is decided by the same rule (or by no rule at all),
+ * so the PMP restrictions can be propagated to a full-page TLB entry
+ */
+bool pmp_is_page_uniform(CPUState *env, target_ulong page_addr)
+{
+    if(unlikely(env->use_external_pmp)) {
+        int region = tlib_extpmp_find_overlapping(page_addr, TARGET_PAGE_SIZE, 0);
+        return region == -1 || (env->pmp_state.addr[region].sa <= page_addr &&
+                                env->pmp_state.addr[region].ea >= page_addr + TARGET_PAGE_SIZE - 1);
+    }
+
+    if(0 == pmp_get_num_rules(env)) {
+        return true;
+    }
+
+    page_addr &= cpu->pmp_addr_mask;
+    return page_addr + TARGET_PAGE_SIZE - 1 <= pmp_segment_end(env, pmp_find_segment(env, page_addr));
+}
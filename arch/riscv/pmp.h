@@ -46,10 +46,21 @@ typedef struct {
     target_ulong ea;
 } pmp_addr_t;
 
+/* A contiguous address range decided by a single rule, `rule` is -1 if no rule matches it */
+typedef struct {
+    target_ulong start;
+    int32_t rule;
+} pmp_segment_t;
+
 typedef struct {
     pmp_entry_t pmp[MAX_RISCV_PMPS];
     pmp_addr_t addr[MAX_RISCV_PMPS];
     uint32_t num_rules;
+
+    /* Sorted address map rebuilt lazily after any rule changes */
+    pmp_segment_t segments[2 * MAX_RISCV_PMPS + 1];
+    uint32_t num_segments;
+    bool segments_valid;
 } pmp_table_t;
 
 void pmpcfg_csr_write(CPUState *env, uint32_t reg_index, target_ulong val);
@@ -57,5 +68,5 @@ target_ulong pmpcfg_csr_read(CPUState *env, uint32_t reg_index);
 void pmpaddr_csr_write(CPUState *env, uint32_t addr_index, target_ulong val);
 target_ulong pmpaddr_csr_read(CPUState *env, uint32_t addr_index);
 int pmp_get_access(CPUState *env, target_ulong addr, target_ulong size, int access_type);
-int pmp_find_overlapping(CPUState *env, target_ulong addr, target_ulong size, int starting_index);
 bool pmp_is_any_region_locked(CPUState *env);
+bool pmp_is_page_uniform(CPUState *env, target_ulong page_addr);
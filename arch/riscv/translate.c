@@ -340,7 +340,7 @@ static inline void gen_goto_tb(DisasContext *dc, int n, target_ulong dest)
         gen_exit_tb(dc->base.tb, n);
     } else {
         tcg_gen_movi_tl(cpu_pc, dest);
-        gen_exit_tb_no_chaining(dc->base.tb);
+        gen_lookup_and_goto_ptr(dc->base.tb);
     }
 }
 
@@ -729,7 +729,7 @@ static void gen_popret_popretz(DisasContext *dc, uint8_t rlist, target_ulong spi
     tcg_gen_andi_tl(cpu_pc, cpu_pc, ~(target_ulong)1);
 
     //  Properly exit the translation block
-    gen_exit_tb_no_chaining(dc->base.tb);
+    gen_lookup_and_goto_ptr(dc->base.tb);
     dc->base.is_jmp = DISAS_BRANCH;
 }
 
@@ -792,7 +792,7 @@ static inline void gen_jt(DisasContext *dc, uint8_t index, bool save_ra)
     tcg_gen_andi_tl(cpu_pc, target_addr, ~0x1);
 
     //  Exit translation block
-    gen_exit_tb_no_chaining(dc->base.tb);
+    gen_lookup_and_goto_ptr(dc->base.tb);
     dc->base.is_jmp = DISAS_BRANCH;
 
     tcg_temp_free(jvt);
@@ -1383,7 +1383,8 @@ static void gen_synch(DisasContext *dc, uint32_t opc)
 {
     switch(opc) {
         case OPC_RISC_FENCE:
-            /* standard fence = NOP */
+            //  The predecessor and successor sets aren't decoded, every fence orders all accesses
+            tcg_gen_mb(TCG_MO_ALL | TCG_BAR_SC);
             break;
         case OPC_RISC_FENCE_I:
             if(!riscv_has_additional_ext(cpu, RISCV_FEATURE_ZIFENCEI)) {
@@ -1843,7 +1844,7 @@ static void gen_jal(CPUState *env, DisasContext *dc, int rd, target_ulong imm)
 
 static void gen_jalr(CPUState *env, DisasContext *dc, uint32_t opc, int rd, int rs1, target_long imm)
 {
-    /* no chaining with JALR */
+    /* no chaining with JALR, the next block is looked up at run time */
     int misaligned = gen_new_label();
     TCGv t0;
     t0 = tcg_temp_new();
@@ -1864,7 +1865,7 @@ static void gen_jalr(CPUState *env, DisasContext *dc, uint32_t opc, int rd, int
                 announce_if_jump_or_ret(rd, rs1, imm, PROFILER_TCG_PC);
             }
 
-            gen_exit_tb_no_chaining(dc->base.tb);
+            gen_lookup_and_goto_ptr(dc->base.tb);
 
             gen_set_label(misaligned);
             generate_exception_mbadaddr(dc, RISCV_EXCP_INST_ADDR_MIS);
@@ -2986,7 +2987,8 @@ static void gen_atomic(CPUState *env, DisasContext *dc, uint32_t opc, int rd, in
         return;
     }
 
-    /* TODO: handle aq, rl bits? - for now just get rid of them: */
+    bool aq = extract32(opc, 26, 1);
+    bool rl = extract32(opc, 25, 1);
     opc = MASK_OP_ATOMIC_NO_AQ_RL(opc);
 
     gen_sync_pc(dc);
@@ -3022,6 +3024,10 @@ static void gen_atomic(CPUState *env, DisasContext *dc, uint32_t opc, int rd, in
         }
     }
 
+    if(rl) {
+        tcg_gen_mb(TCG_MO_ALL | TCG_BAR_STRL);
+    }
+
     gen_store_table_lock(cpu, source1);
 
     int done = gen_new_label();
@@ -3042,6 +3048,10 @@ static void gen_atomic(CPUState *env, DisasContext *dc, uint32_t opc, int rd, in
 
     gen_store_table_unlock(cpu, source1);
 
+    if(aq) {
+        tcg_gen_mb(TCG_MO_ALL | TCG_BAR_LDAQ);
+    }
+
     gen_set_gpr(rd, result);
     tcg_temp_free(source1);
     tcg_temp_free(source2);
@@ -3696,6 +3706,137 @@ static void gen_fp_arith(DisasContext *dc, uint32_t opc, int rd, int rs1, int rs
     tcg_temp_free(write_int_rd);
 }
 
+static inline bool is_inline_counter_csr(int csr)
+{
+    switch(csr) {
+        case CSR_CYCLE:
+        case CSR_TIME:
+        case CSR_INSTRET:
+#if defined(TARGET_RISCV32)
+        case CSR_CYCLEH:
+        case CSR_TIMEH:
+        case CSR_INSTRETH:
+#endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+static inline void gen_counter_inhibit_check(uint32_t inhibit_bit, int slow_path)
+{
+    if(cpu->privilege_architecture >= RISCV_PRIV1_11) {
+        TCGv_i32 mcountinhibit = tcg_temp_new_i32();
+        tcg_gen_ld_i32(mcountinhibit, cpu_env, offsetof(CPUState, mcountinhibit));
+        tcg_gen_andi_i32(mcountinhibit, mcountinhibit, inhibit_bit);
+        tcg_gen_brcondi_i32(TCG_COND_NE, mcountinhibit, 0, slow_path);
+        tcg_temp_free_i32(mcountinhibit);
+    }
+}
+
+/*
+ * Generates a side-effect free read of the `cycle`, `time` or `instret` counter (rs1 == x0) as inline loads and arithmetic,
+ * without ending the block. The values are computed the same way `csr_read_helper` does. If the counter is not enabled
+ * for the current privilege level, is inhibited, the CPU doesn't execute one cycle per instruction or the host didn't
+ * register a linear time source, the regular CSR helper handles the access instead.
+ *
+ * Returns false if the read can't be generated inline at all.
+ */
+static bool gen_counter_csr_read(DisasContext *dc, int rd, int csr)
+{
+    if(cpu->privilege_architecture < RISCV_PRIV1_10 || has_custom_csr(cpu, csr)) {
+        return false;
+    }
+
+    int slow_path = gen_new_label();
+    int done = gen_new_label();
+
+    if(dc->base.mem_idx != PRV_M) {
+        //  U-mode additionally needs the `scounteren` bit if S-mode is implemented,
+        //  requiring it unconditionally only sends more reads to the helper
+        target_ulong counter_bit = (target_ulong)1 << (csr & 31);
+        TCGv counteren = tcg_temp_new();
+        tcg_gen_ld_tl(counteren, cpu_env, offsetof(CPUState, mcounteren));
+        tcg_gen_andi_tl(counteren, counteren, counter_bit);
+        tcg_gen_brcondi_tl(TCG_COND_EQ, counteren, 0, slow_path);
+        if(dc->base.mem_idx == PRV_U) {
+            tcg_gen_ld_tl(counteren, cpu_env, offsetof(CPUState, scounteren));
+            tcg_gen_andi_tl(counteren, counteren, counter_bit);
+            tcg_gen_brcondi_tl(TCG_COND_EQ, counteren, 0, slow_path);
+        }
+        tcg_temp_free(counteren);
+    }
+
+    TCGv_i64 value = tcg_temp_new_i64();
+    TCGv_i64 tmp = tcg_temp_new_i64();
+    switch(csr & ~(CSR_CYCLEH - CSR_CYCLE)) {
+        case CSR_CYCLE:
+            gen_counter_inhibit_check(MCOUNTINHIBIT_CY, slow_path);
+            //  Scaling by a fractional cycles-per-instruction ratio is left to the helper
+            tcg_gen_ld32u_i64(tmp, cpu_env, offsetof(CPUState, millicycles_per_instruction));
+            tcg_gen_brcondi_i64(TCG_COND_NE, tmp, 1000, slow_path);
+            //  value = instructions_count_total_value - mcycle_snapshot + mcycle_snapshot_offset
+            tcg_gen_ld_i64(value, cpu_env, offsetof(CPUState, instructions_count_total_value));
+            tcg_gen_ld_i64(tmp, cpu_env, offsetof(CPUState, mcycle_snapshot));
+            tcg_gen_sub_i64(value, value, tmp);
+            tcg_gen_ld_i64(tmp, cpu_env, offsetof(CPUState, mcycle_snapshot_offset));
+            tcg_gen_add_i64(value, value, tmp);
+            break;
+        case CSR_INSTRET:
+            gen_counter_inhibit_check(MCOUNTINHIBIT_IR, slow_path);
+            //  value = instructions_count_total_value - minstret_snapshot + minstret_snapshot_offset
+            tcg_gen_ld_i64(value, cpu_env, offsetof(CPUState, instructions_count_total_value));
+            tcg_gen_ld_i64(tmp, cpu_env, offsetof(CPUState, minstret_snapshot));
+            tcg_gen_sub_i64(value, value, tmp);
+            tcg_gen_ld_i64(tmp, cpu_env, offsetof(CPUState, minstret_snapshot_offset));
+            tcg_gen_add_i64(value, value, tmp);
+            break;
+        case CSR_TIME: {
+            tcg_gen_ld8u_i64(tmp, cpu_env, offsetof(CPUState, time_source_linear));
+            tcg_gen_brcondi_i64(TCG_COND_EQ, tmp, 0, slow_path);
+            //  value = time_base + ((instructions_count_total_value - time_base_instructions) * time_ticks_per_instruction >> 32)
+            TCGv_i64 high = tcg_temp_new_i64();
+            tcg_gen_ld_i64(value, cpu_env, offsetof(CPUState, instructions_count_total_value));
+            tcg_gen_ld_i64(tmp, cpu_env, offsetof(CPUState, time_base_instructions));
+            tcg_gen_sub_i64(value, value, tmp);
+            tcg_gen_ld_i64(tmp, cpu_env, offsetof(CPUState, time_ticks_per_instruction));
+            tcg_gen_mulu2_i64(value, high, value, tmp);
+            tcg_gen_extract2_i64(value, value, high, 32);
+            tcg_gen_ld_i64(tmp, cpu_env, offsetof(CPUState, time_base));
+            tcg_gen_add_i64(value, value, tmp);
+            tcg_temp_free_i64(high);
+            break;
+        }
+        default:
+            tlib_abortf("Unexpected counter CSR: 0x%x", csr);
+            break;
+    }
+#if defined(TARGET_RISCV32)
+    if(csr & (CSR_CYCLEH - CSR_CYCLE)) {
+        tcg_gen_shri_i64(value, value, 32);
+    }
+#endif
+
+    TCGv result = tcg_temp_new();
+    tcg_gen_trunc_i64_tl(result, value);
+    gen_set_gpr(rd, result);
+    tcg_gen_br(done);
+    tcg_temp_free_i64(value);
+    tcg_temp_free_i64(tmp);
+
+    gen_set_label(slow_path);
+    TCGv zero = tcg_const_tl(0);
+    TCGv csr_store = tcg_const_tl(csr);
+    gen_helper_csrrs(result, cpu_env, zero, csr_store, zero);
+    gen_set_gpr(rd, result);
+    tcg_temp_free(csr_store);
+    tcg_temp_free(zero);
+    tcg_temp_free(result);
+
+    gen_set_label(done);
+    return true;
+}
+
 static void gen_system(DisasContext *dc, uint32_t opc, int rd, int rs1, int rs2, int funct12)
 {
     gen_sync_pc(dc);
@@ -3773,6 +3914,13 @@ static void gen_system(DisasContext *dc, uint32_t opc, int rd, int rs1, int rs2,
                         "lead to an illegal instruction exception. PC: 0x%llx, opcode: 0x%0*llx",
                         dc->base.pc, /* padding */ 2 * instruction_length, format_opcode(dc->opcode, instruction_length));
         }
+        //  Counter reads don't change the CPU state, so they neither need a helper call nor have to end the block
+        bool is_read_only =
+            (opc == OPC_RISC_CSRRS || opc == OPC_RISC_CSRRC || opc == OPC_RISC_CSRRSI || opc == OPC_RISC_CSRRCI) && rs1 == 0;
+        if(is_read_only && is_inline_counter_csr(funct12) && gen_counter_csr_read(dc, rd, funct12)) {
+            return;
+        }
+
         TCGv source1, csr_store, dest, rs1_pass, imm_rs1;
         source1 = tcg_temp_new();
         csr_store = tcg_temp_new();
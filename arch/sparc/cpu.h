@@ -17,6 +17,9 @@
 
 #include "cpu-defs.h"
 
+/* SPARC V8 uses Total Store Order, only stores may be reordered after later loads */
+#define TCG_GUEST_DEFAULT_MO (TCG_MO_ALL & ~TCG_MO_ST_LD)
+
 #include "softfloat-2.h"
 
 #define SUPPORTS_GUEST_PROFILING
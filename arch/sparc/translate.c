@@ -47,6 +47,7 @@ static TCGv cpu_asr[16] = { 0, 0x107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
 static TCGv cpu_tbr;
 static TCGv cpu_cond, cpu_dst, cpu_addr, cpu_val;
 static TCGv cpu_wim;
+static TCGv_i32 cpu_cwp;
 /* local register indexes (only used inside old micro ops) */
 static TCGv cpu_tmp0;
 static TCGv_i32 cpu_tmp32;
@@ -74,6 +75,7 @@ void translate_init()
     /* init various static tables */
     cpu_regwptr = tcg_global_mem_new_ptr(TCG_AREG0, offsetof(CPUState, regwptr), "regwptr");
     cpu_wim = tcg_global_mem_new(TCG_AREG0, offsetof(CPUState, wim), "wim");
+    cpu_cwp = tcg_global_mem_new_i32(TCG_AREG0, offsetof(CPUState, cwp), "cwp");
     cpu_cond = tcg_global_mem_new(TCG_AREG0, offsetof(CPUState, cond), "cond");
     cpu_cc_src = tcg_global_mem_new(TCG_AREG0, offsetof(CPUState, cc_src), "cc_src");
     cpu_cc_src2 = tcg_global_mem_new(TCG_AREG0, offsetof(CPUState, cc_src2), "cc_src2");
@@ -207,10 +209,10 @@ static inline void gen_goto_tb(DisasContext *s, int tb_num, target_ulong pc, tar
         tcg_gen_movi_tl(cpu_npc, npc);
         gen_exit_tb(tb, tb_num);
     } else {
-        /* jump to another page: currently not optimized */
+        /* jump to another page: look the block up at run time */
         tcg_gen_movi_tl(cpu_pc, pc);
         tcg_gen_movi_tl(cpu_npc, npc);
-        gen_exit_tb_no_chaining(tb);
+        gen_lookup_and_goto_ptr(tb);
     }
 }
 
@@ -1477,6 +1479,40 @@ static inline void generate_stack_frame_announcement(DisasContext *dc, int type)
     }
 }
 
+/* Rotates the register window for save (is_save) or restore.  As long as
+   neither the current nor the new window is the last one, whose ins are
+   kept at a temporary location, and the new window is valid in wim, this
+   only moves cwp and regwptr.  Otherwise the helper handles the wrap
+   registers and raises the window overflow/underflow trap. */
+static void gen_rotate_window(DisasContext *dc, bool is_save)
+{
+    int nwindows = dc->def->nwindows;
+    int l_slow = gen_new_label();
+    int l_done = gen_new_label();
+    TCGv_i32 r_cwp = tcg_temp_local_new_i32();
+    TCGv_i32 r_tmp = tcg_temp_new_i32();
+
+    tcg_gen_addi_i32(r_cwp, cpu_cwp, is_save ? -1 : 1);
+    /* save: 1 <= cwp <= nwindows - 2, restore: cwp <= nwindows - 3 */
+    tcg_gen_brcondi_i32(TCG_COND_GEU, is_save ? r_cwp : cpu_cwp, nwindows - 2, l_slow);
+    tcg_gen_shr_i32(r_tmp, cpu_wim, r_cwp);
+    tcg_gen_andi_i32(r_tmp, r_tmp, 1);
+    tcg_gen_brcondi_i32(TCG_COND_NE, r_tmp, 0, l_slow);
+    tcg_gen_mov_i32(cpu_cwp, r_cwp);
+    tcg_gen_addi_ptr(cpu_regwptr, cpu_regwptr, (is_save ? -16 : 16) * (int)sizeof(target_ulong));
+    tcg_gen_br(l_done);
+
+    gen_set_label(l_slow);
+    if(is_save) {
+        gen_helper_save();
+    } else {
+        gen_helper_restore();
+    }
+    gen_set_label(l_done);
+    tcg_temp_free_i32(r_tmp);
+    tcg_temp_free_i32(r_cwp);
+}
+
 /* before an instruction, dc->base.pc must be static */
 static int disas_insn(CPUState *env, DisasContext *dc)
 {
@@ -2351,14 +2387,14 @@ static int disas_insn(CPUState *env, DisasContext *dc)
                         break;
                     case 0x3c: /* save */
                         save_state(dc, cpu_cond);
-                        gen_helper_save();
+                        gen_rotate_window(dc, true);
                         gen_movl_TN_reg(rd, cpu_dst);
                         generate_stack_frame_announcement(dc, STACK_FRAME_ADD);
                         break;
                     case 0x3d: /* restore */
                         generate_stack_frame_announcement(dc, STACK_FRAME_POP);
                         save_state(dc, cpu_cond);
-                        gen_helper_restore();
+                        gen_rotate_window(dc, false);
                         gen_movl_TN_reg(rd, cpu_dst);
                         break;
                     default:
@@ -2880,7 +2916,7 @@ uint32_t gen_intermediate_code_epilogue(CPUState *env, DisasContextBase *base)
                 tcg_gen_movi_tl(cpu_pc, dc->base.pc);
             }
             save_npc(dc, cpu_cond);
-            gen_exit_tb_no_chaining(dc->base.tb);
+            gen_lookup_and_goto_ptr(dc->base.tb);
         }
     }
     return 0;
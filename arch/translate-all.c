@@ -39,7 +39,12 @@ static int block_header_interrupted_label;
 CPUBreakpoint *process_breakpoints(CPUState *env, target_ulong pc)
 {
     CPUBreakpoint *bp;
-    QTAILQ_FOREACH(bp, &env->breakpoints, entry) {
+
+    //  Most instructions are on pages without any breakpoint
+    if(likely(env->breakpoint_page_count[bp_page_hash_func(pc)] == 0)) {
+        return NULL;
+    }
+    for(bp = env->breakpoint_hash[bp_hash_func(pc)]; bp != NULL; bp = bp->hash_next) {
         if(bp->pc == pc) {
             return bp;
         }
@@ -127,6 +132,17 @@ void gen_exit_tb_no_chaining(TranslationBlock *tb)
     tcg_gen_exit_tb(0);
 }
 
+//  Ends the block with a jump to the TB matching the current CPU state. Use it instead of `gen_exit_tb_no_chaining`
+//  for indirect branches and for direct ones that can't be chained; the main loop is only entered on a lookup miss
+void gen_lookup_and_goto_ptr(TranslationBlock *tb)
+{
+    gen_block_finished_hook(tb, tb->icount);
+    TCGv_ptr host_code = tcg_temp_new_ptr();
+    gen_helper_lookup_tb_ptr(host_code, cpu_env);
+    tcg_gen_goto_ptr(host_code);
+    tcg_temp_free_ptr(host_code);
+}
+
 static inline void gen_block_footer(TranslationBlock *tb)
 {
     if(tlib_is_on_block_translation_enabled) {
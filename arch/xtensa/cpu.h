@@ -533,6 +533,7 @@ void xtensa_cpu_set_irq_pending_bit(CPUState *cpu, uint32_t irq, uint32_t value)
 
 void xtensa_collect_sr_names(const XtensaConfig *config);
 void xtensa_translate_init(void);
+void xtensa_translate_dispose(void);
 int *xtensa_get_regfile_by_name(const char *name, int entries, int bits);
 void xtensa_sync_window_from_phys(CPUState *env);
 void xtensa_sync_phys_from_window(CPUState *env);
@@ -590,6 +591,17 @@ static inline uint32_t xtensa_replicate_windowstart(CPUState *env)
     return env->sregs[WINDOW_START] | (env->sregs[WINDOW_START] << env->config->nareg / 4);
 }
 
+/* Distance to the nearest of the 3 windows below WindowBase with its
+   WindowStart bit set, 0 if there is none.  That's the only callinc retw
+   accepts without an underflow or an illegal instruction exception.  */
+static inline uint32_t xtensa_retw_distance(CPUState *env)
+{
+    uint32_t nwindows = env->config->nareg / 4;
+    uint32_t below = (xtensa_replicate_windowstart(env) >> (env->sregs[WINDOW_BASE] + nwindows - 3)) & 0x7;
+
+    return below ? 3 - (31 - clz32(below)) : 0;
+}
+
 /* MMU modes definitions */
 #define MMU_USER_IDX 3
 
@@ -612,6 +624,8 @@ static inline int cpu_mmu_index(CPUState *env)
 #define XTENSA_TBFLAG_CWOE           0x40000
 #define XTENSA_TBFLAG_CALLINC_MASK   0x180000
 #define XTENSA_TBFLAG_CALLINC_SHIFT  19
+#define XTENSA_TBFLAG_RETW_MASK      0x600000
+#define XTENSA_TBFLAG_RETW_SHIFT     21
 
 #define XTENSA_CSBASE_LEND_MASK      0x0000ffff
 #define XTENSA_CSBASE_LEND_SHIFT     0
@@ -677,6 +691,7 @@ static inline void cpu_get_tb_cpu_state(CPUState *env, target_ulong *pc, target_
 
         *flags |= (w << XTENSA_TBFLAG_WINDOW_SHIFT) | XTENSA_TBFLAG_CWOE;
         *flags |= extract32(env->sregs[PS], PS_CALLINC_SHIFT, PS_CALLINC_LEN) << XTENSA_TBFLAG_CALLINC_SHIFT;
+        *flags |= xtensa_retw_distance(env) << XTENSA_TBFLAG_RETW_SHIFT;
     } else {
         *flags |= 3 << XTENSA_TBFLAG_WINDOW_SHIFT;
     }
@@ -702,6 +717,7 @@ struct DisasContext {
 
     unsigned window;
     unsigned callinc;
+    unsigned retw_distance;
     bool cwoe;
 
     bool debug;
@@ -195,5 +195,5 @@ int arch_tlb_fill(CPUState *env, target_ulong address, MMUAccessType access_type
 
 void tlib_arch_dispose()
 {
-    //  TODO: do we want to put sth here? Probably not - there are no mallocs in our code
+    xtensa_translate_dispose();
 }
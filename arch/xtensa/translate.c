@@ -777,93 +777,117 @@ static int arg_copy_compare(const void *a, const void *b)
     return pa->resource < pb->resource ? -1 : (pa->resource > pb->resource ? 1 : 0);
 }
 
-static unsigned int disas_xtensa_insn(CPUState *env, DisasContext *dc)
+/*
+ * Decoding an instruction through libisa is expensive, so the decoded slots are kept
+ * in a direct-mapped cache keyed by the core configuration and the raw instruction bytes.
+ * Since the bytes are a part of the key, entries never go stale after a TB flush or SMC.
+ * PC-relative operands are stored unrelocated and fixed up on every lookup.
+ */
+#define DECODE_CACHE_BITS 12
+#define DECODE_CACHE_SIZE (1 << DECODE_CACHE_BITS)
+
+struct decoded_slot {
+    struct slot_prop prop;
+    xtensa_opcode opc;
+    uint32_t pc_relative;
+    uint8_t operand[MAX_OPCODE_ARGS];
+};
+
+struct decoded_insn {
+    const XtensaConfig *config;
+    unsigned len;
+    unsigned char bytes[MAX_INSN_LENGTH];
+    uint32_t windowed_register;
+    int slots;
+    struct decoded_slot slot[];
+};
+
+static struct decoded_insn *decode_cache[DECODE_CACHE_SIZE];
+
+static inline unsigned decode_cache_hash(const XtensaConfig *config, const unsigned char *b, unsigned len)
 {
-    xtensa_isa isa = dc->config->isa;
-    unsigned char b[MAX_INSN_LENGTH] = { ldub_code(dc->pc) };
-    unsigned len = xtensa_op0_insn_len(dc, b[0]);
-    xtensa_format fmt;
-    int slot, slots;
+    uint32_t hash = 2166136261u ^ (uint32_t)(uintptr_t)config;
     unsigned i;
-    uint32_t op_flags = 0;
-    struct slot_prop slot_prop[MAX_INSN_SLOTS];
-    struct slot_prop *ordered[MAX_INSN_SLOTS];
-    struct opcode_arg_copy arg_copy[MAX_INSN_SLOTS * MAX_OPCODE_ARGS];
-    unsigned n_arg_copy = 0;
-    uint32_t debug_cause = 0;
-    uint32_t windowed_register = 0;
-    uint32_t coprocessor = 0;
 
-    if(len == XTENSA_UNDEFINED) {
-        tlib_printf(LOG_LEVEL_ERROR, "unknown instruction length (pc = %08x)\n", dc->pc);
-        gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
-        return 0;
+    for(i = 0; i < len; ++i) {
+        hash = (hash ^ b[i]) * 16777619u;
     }
+    return (hash ^ (hash >> DECODE_CACHE_BITS)) & (DECODE_CACHE_SIZE - 1);
+}
+
+static struct decoded_insn *decode_xtensa_insn(DisasContext *dc, const unsigned char *b, unsigned len)
+{
+    const XtensaConfig *config = dc->config;
+    xtensa_isa isa = config->isa;
+    struct decoded_insn *insn;
+    xtensa_format fmt;
+    int slot, slots;
 
-    dc->base.pc_next = dc->pc + len;
-    for(i = 1; i < len; ++i) {
-        b[i] = ldub_code(dc->pc + i);
-    }
     xtensa_insnbuf_from_chars(isa, dc->insnbuf, b, len);
     fmt = xtensa_format_decode(isa, dc->insnbuf);
     if(fmt == XTENSA_UNDEFINED) {
         tlib_printf(LOG_LEVEL_ERROR, "unrecognized instruction format (pc = %08x)\n", dc->pc);
-        gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
-        return 0;
+        return NULL;
     }
     slots = xtensa_format_num_slots(isa, fmt);
+
+    insn = tlib_mallocz(sizeof(*insn) + sizeof(insn->slot[0]) * slots);
+    insn->config = config;
+    insn->len = len;
+    memcpy(insn->bytes, b, len);
+    insn->slots = slots;
+
     for(slot = 0; slot < slots; ++slot) {
+        struct decoded_slot *dslot = &insn->slot[slot];
+        struct slot_prop *prop = &dslot->prop;
+        OpcodeArg *arg = prop->arg;
         xtensa_opcode opc;
         int opnd, vopnd, opnds;
-        OpcodeArg *arg = slot_prop[slot].arg;
-        XtensaOpcodeOps *ops;
 
         xtensa_format_get_slot(isa, fmt, slot, dc->insnbuf, dc->slotbuf);
         opc = xtensa_opcode_decode(isa, fmt, slot, dc->slotbuf);
         if(opc == XTENSA_UNDEFINED) {
             tlib_printf(LOG_LEVEL_ERROR, "unrecognized opcode in slot %d (pc = %08x)\n", slot, dc->pc);
-            gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
-            return 0;
+            tlib_free(insn);
+            return NULL;
         }
-
-        char b_print[2 * MAX_INSN_LENGTH + 1];
-        for(int i = 0; i < len; i++) {
-            sprintf(&b_print[2 * i], "%02X", b[len - 1 - i]);
-        }
-        b_print[2 * len + 1] = '\0';
-#if DEBUG
-        tlib_printf(LOG_LEVEL_DEBUG, "0x%08x: Translating %s (%s); slot: %d/%d", dc->pc, xtensa_opcode_name(isa, opc), b_print,
-                    slot + 1, slots);
-#endif
+        dslot->opc = opc;
+        prop->ops = config->opcode_ops[opc];
 
         opnds = xtensa_opcode_num_operands(isa, opc);
 
         for(opnd = vopnd = 0; opnd < opnds; ++opnd) {
-            int *register_file = NULL;
-            xtensa_regfile rf;
+            bool visible = xtensa_operand_is_visible(isa, opc, opnd);
+            bool is_register = xtensa_operand_is_register(isa, opc, opnd);
+            xtensa_regfile rf = XTENSA_UNDEFINED;
+            uint32_t v = 0;
 
-            if(xtensa_operand_is_register(isa, opc, opnd)) {
-                rf = xtensa_operand_regfile(isa, opc, opnd);
-                register_file = dc->config->regfile[rf];
+            if(!visible && !is_register) {
+                continue;
+            }
 
-                if(rf == dc->config->a_regfile) {
-                    uint32_t v;
+            xtensa_operand_get_field(isa, opc, opnd, fmt, slot, dc->slotbuf, &v);
+            xtensa_operand_decode(isa, opc, opnd, &v);
 
-                    xtensa_operand_get_field(isa, opc, opnd, fmt, slot, dc->slotbuf, &v);
-                    xtensa_operand_decode(isa, opc, opnd, &v);
-                    windowed_register |= 1u << v;
+            if(is_register) {
+                rf = xtensa_operand_regfile(isa, opc, opnd);
+                if(rf == config->a_regfile) {
+                    insn->windowed_register |= 1u << v;
+                }
+                if(slots > 1) {
+                    opcode_add_resource(prop, encode_resource(RES_REGFILE, rf, v), xtensa_operand_inout(isa, opc, opnd),
+                                        visible ? vopnd : -1);
                 }
             }
-            if(xtensa_operand_is_visible(isa, opc, opnd)) {
-                uint32_t v;
+            if(visible) {
+                int *register_file = is_register ? config->regfile[rf] : NULL;
 
-                xtensa_operand_get_field(isa, opc, opnd, fmt, slot, dc->slotbuf, &v);
-                xtensa_operand_decode(isa, opc, opnd, &v);
                 arg[vopnd].raw_imm = v;
+                arg[vopnd].imm = v;
                 if(xtensa_operand_is_PCrelative(isa, opc, opnd)) {
-                    xtensa_operand_undo_reloc(isa, opc, opnd, &v, dc->pc);
+                    dslot->pc_relative |= 1u << vopnd;
                 }
-                arg[vopnd].imm = v;
+                dslot->operand[vopnd] = opnd;
                 if(register_file) {
                     arg[vopnd].in = register_file[v];
                     arg[vopnd].out = register_file[v];
@@ -874,8 +898,117 @@ static unsigned int disas_xtensa_insn(CPUState *env, DisasContext *dc)
                 ++vopnd;
             }
         }
-        ops = dc->config->opcode_ops[opc];
-        slot_prop[slot].ops = ops;
+
+        if(slots > 1) {
+            if(prop->ops) {
+                prop->op_flags |= prop->ops->op_flags & XTENSA_OP_LOAD_STORE;
+            }
+
+            opnds = xtensa_opcode_num_stateOperands(isa, opc);
+
+            for(opnd = 0; opnd < opnds; ++opnd) {
+                xtensa_state state = xtensa_stateOperand_state(isa, opc, opnd);
+
+                opcode_add_resource(prop, encode_resource(RES_STATE, 0, state), xtensa_stateOperand_inout(isa, opc, opnd), -1);
+            }
+            if(xtensa_opcode_is_branch(isa, opc) || xtensa_opcode_is_jump(isa, opc) || xtensa_opcode_is_loop(isa, opc) ||
+               xtensa_opcode_is_call(isa, opc)) {
+                prop->op_flags |= XTENSA_OP_CONTROL_FLOW;
+            }
+
+            qsort(prop->in, prop->n_in, sizeof(prop->in[0]), resource_compare);
+            qsort(prop->out, prop->n_out, sizeof(prop->out[0]), resource_compare);
+        }
+    }
+    return insn;
+}
+
+static const struct decoded_insn *get_decoded_insn(DisasContext *dc, const unsigned char *b, unsigned len)
+{
+    unsigned index = decode_cache_hash(dc->config, b, len);
+    struct decoded_insn *insn = decode_cache[index];
+
+    if(insn != NULL && insn->config == dc->config && insn->len == len && memcmp(insn->bytes, b, len) == 0) {
+        return insn;
+    }
+
+    insn = decode_xtensa_insn(dc, b, len);
+    if(insn != NULL) {
+        tlib_free(decode_cache[index]);
+        decode_cache[index] = insn;
+    }
+    return insn;
+}
+
+void xtensa_translate_dispose(void)
+{
+    unsigned i;
+
+    for(i = 0; i < DECODE_CACHE_SIZE; ++i) {
+        tlib_free(decode_cache[i]);
+        decode_cache[i] = NULL;
+    }
+}
+
+static unsigned int disas_xtensa_insn(CPUState *env, DisasContext *dc)
+{
+    xtensa_isa isa = dc->config->isa;
+    unsigned char b[MAX_INSN_LENGTH] = { ldub_code(dc->pc) };
+    unsigned len = xtensa_op0_insn_len(dc, b[0]);
+    const struct decoded_insn *insn;
+    int slot, slots;
+    unsigned i;
+    uint32_t op_flags = 0;
+    struct slot_prop slot_prop[MAX_INSN_SLOTS];
+    struct slot_prop *ordered[MAX_INSN_SLOTS];
+    struct opcode_arg_copy arg_copy[MAX_INSN_SLOTS * MAX_OPCODE_ARGS];
+    unsigned n_arg_copy = 0;
+    uint32_t debug_cause = 0;
+    uint32_t windowed_register = 0;
+    uint32_t coprocessor = 0;
+
+    if(len == XTENSA_UNDEFINED) {
+        tlib_printf(LOG_LEVEL_ERROR, "unknown instruction length (pc = %08x)\n", dc->pc);
+        gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
+        return 0;
+    }
+
+    dc->base.pc_next = dc->pc + len;
+    for(i = 1; i < len; ++i) {
+        b[i] = ldub_code(dc->pc + i);
+    }
+    insn = get_decoded_insn(dc, b, len);
+    if(insn == NULL) {
+        gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
+        return 0;
+    }
+    slots = insn->slots;
+    windowed_register = insn->windowed_register;
+
+    for(slot = 0; slot < slots; ++slot) {
+        const struct decoded_slot *dslot = &insn->slot[slot];
+        OpcodeArg *arg = slot_prop[slot].arg;
+        XtensaOpcodeOps *ops = dslot->prop.ops;
+
+        slot_prop[slot] = dslot->prop;
+        for(i = 0; i < MAX_OPCODE_ARGS; ++i) {
+            if(dslot->pc_relative & (1u << i)) {
+                uint32_t v = arg[i].raw_imm;
+
+                xtensa_operand_undo_reloc(isa, dslot->opc, dslot->operand[i], &v, dc->pc);
+                arg[i].imm = v;
+            }
+        }
+
+#if DEBUG
+        char b_print[2 * MAX_INSN_LENGTH + 1];
+        for(int i = 0; i < len; i++) {
+            sprintf(&b_print[2 * i], "%02X", b[len - 1 - i]);
+        }
+        b_print[2 * len + 1] = '\0';
+        tlib_printf(LOG_LEVEL_DEBUG, "0x%08x: Translating %s (%s); slot: %d/%d", dc->pc, xtensa_opcode_name(isa, dslot->opc), b_print,
+                    slot + 1, slots);
+#endif
 
         if(ops) {
             op_flags |= ops->op_flags;
@@ -883,8 +1016,8 @@ static unsigned int disas_xtensa_insn(CPUState *env, DisasContext *dc)
                 op_flags |= ops->test_exceptions(dc, arg, ops->par);
             }
         } else {
-            tlib_printf(LOG_LEVEL_ERROR, "unimplemented opcode '%s' in slot %d (pc = %08x)\n", xtensa_opcode_name(isa, opc), slot,
-                        dc->pc);
+            tlib_printf(LOG_LEVEL_ERROR, "unimplemented opcode '%s' in slot %d (pc = %08x)\n", xtensa_opcode_name(isa, dslot->opc),
+                        slot, dc->pc);
             op_flags |= XTENSA_OP_ILL;
         }
         if(op_flags & XTENSA_OP_ILL) {
@@ -898,47 +1031,6 @@ static unsigned int disas_xtensa_insn(CPUState *env, DisasContext *dc)
             windowed_register |= ops->test_overflow(dc, arg, ops->par);
         }
         coprocessor |= ops->coprocessor;
-
-        if(slots > 1) {
-            slot_prop[slot].n_in = 0;
-            slot_prop[slot].n_out = 0;
-            slot_prop[slot].op_flags = ops->op_flags & XTENSA_OP_LOAD_STORE;
-
-            opnds = xtensa_opcode_num_operands(isa, opc);
-
-            for(opnd = vopnd = 0; opnd < opnds; ++opnd) {
-                bool visible = xtensa_operand_is_visible(isa, opc, opnd);
-
-                if(xtensa_operand_is_register(isa, opc, opnd)) {
-                    xtensa_regfile rf = xtensa_operand_regfile(isa, opc, opnd);
-                    uint32_t v = 0;
-
-                    xtensa_operand_get_field(isa, opc, opnd, fmt, slot, dc->slotbuf, &v);
-                    xtensa_operand_decode(isa, opc, opnd, &v);
-                    opcode_add_resource(slot_prop + slot, encode_resource(RES_REGFILE, rf, v),
-                                        xtensa_operand_inout(isa, opc, opnd), visible ? vopnd : -1);
-                }
-                if(visible) {
-                    ++vopnd;
-                }
-            }
-
-            opnds = xtensa_opcode_num_stateOperands(isa, opc);
-
-            for(opnd = 0; opnd < opnds; ++opnd) {
-                xtensa_state state = xtensa_stateOperand_state(isa, opc, opnd);
-
-                opcode_add_resource(slot_prop + slot, encode_resource(RES_STATE, 0, state),
-                                    xtensa_stateOperand_inout(isa, opc, opnd), -1);
-            }
-            if(xtensa_opcode_is_branch(isa, opc) || xtensa_opcode_is_jump(isa, opc) || xtensa_opcode_is_loop(isa, opc) ||
-               xtensa_opcode_is_call(isa, opc)) {
-                slot_prop[slot].op_flags |= XTENSA_OP_CONTROL_FLOW;
-            }
-
-            qsort(slot_prop[slot].in, slot_prop[slot].n_in, sizeof(slot_prop[slot].in[0]), resource_compare);
-            qsort(slot_prop[slot].out, slot_prop[slot].n_out, sizeof(slot_prop[slot].out[0]), resource_compare);
-        }
     }
 
     if(slots > 1) {
@@ -970,7 +1062,8 @@ static unsigned int disas_xtensa_insn(CPUState *env, DisasContext *dc)
         return len;
     }
 
-    if(op_flags & XTENSA_OP_UNDERFLOW) {
+    /* retw past the illegal instruction check can't underflow if the caller's window is known to be live */
+    if((op_flags & XTENSA_OP_UNDERFLOW) && !dc->retw_distance) {
         TCGv_i32 tmp = tcg_const_i32(dc->pc);
 
         gen_helper_test_underflow_retw(cpu_env, tmp);
@@ -1096,6 +1189,7 @@ static void xtensa_tr_init_disas_context(DisasContext *dc, CPUState *env)
     dc->window = ((tb_flags & XTENSA_TBFLAG_WINDOW_MASK) >> XTENSA_TBFLAG_WINDOW_SHIFT);
     dc->cwoe = tb_flags & XTENSA_TBFLAG_CWOE;
     dc->callinc = ((tb_flags & XTENSA_TBFLAG_CALLINC_MASK) >> XTENSA_TBFLAG_CALLINC_SHIFT);
+    dc->retw_distance = ((tb_flags & XTENSA_TBFLAG_RETW_MASK) >> XTENSA_TBFLAG_RETW_SHIFT);
     init_sar_tracker(dc);
 }
 
@@ -1466,13 +1560,17 @@ static uint32_t test_overflow_entry(DisasContext *dc, const OpcodeArg arg[], con
 
 static void translate_entry(DisasContext *dc, const OpcodeArg arg[], const uint32_t par[])
 {
-    TCGv_i32 pc = tcg_const_i32(dc->pc);
-    TCGv_i32 s = tcg_const_i32(arg[0].imm);
-    TCGv_i32 imm = tcg_const_i32(arg[1].imm);
-    gen_helper_entry(cpu_env, pc, s, imm);
-    tcg_temp_free(imm);
-    tcg_temp_free(s);
-    tcg_temp_free(pc);
+    TCGv_i32 tmp = tcg_temp_new_i32();
+    TCGv_i32 bit = tcg_const_i32(1);
+
+    /* callinc is known from the TB flags, the window rotation itself is done by sync_windowbase */
+    tcg_gen_subi_i32(cpu_R[(dc->callinc << 2) | (arg[0].imm & 3)], cpu_R[arg[0].imm], arg[1].imm);
+    tcg_gen_addi_i32(cpu_windowbase_next, cpu_SR[WINDOW_BASE], dc->callinc);
+    tcg_gen_andi_i32(tmp, cpu_windowbase_next, dc->config->nareg / 4 - 1);
+    tcg_gen_shl_i32(bit, bit, tmp);
+    tcg_gen_or_i32(cpu_SR[WINDOW_START], cpu_SR[WINDOW_START], bit);
+    tcg_temp_free(bit);
+    tcg_temp_free(tmp);
 }
 
 static void translate_extui(DisasContext *dc, const OpcodeArg arg[], const uint32_t par[])
@@ -1866,10 +1964,25 @@ static uint32_t test_exceptions_retw(DisasContext *dc, const OpcodeArg arg[], co
         tlib_printf(LOG_LEVEL_ERROR, "Illegal retw instruction(pc = %08x)\n", dc->pc);
         return XTENSA_OP_ILL;
     } else {
-        TCGv_i32 tmp = tcg_const_i32(dc->pc);
+        TCGv_i32 tmp;
+        int label = -1;
+
+        /* Only the callinc equal to retw_distance is valid then, the helper raises the exception otherwise */
+        if(dc->retw_distance) {
+            TCGv_i32 n = tcg_temp_new_i32();
 
+            label = gen_new_label();
+            tcg_gen_shri_i32(n, cpu_R[0], 30);
+            tcg_gen_brcondi_i32(TCG_COND_EQ, n, dc->retw_distance, label);
+            tcg_temp_free(n);
+        }
+        /* Created after the branch, normal temps don't survive the end of a basic block */
+        tmp = tcg_const_i32(dc->pc);
         gen_helper_test_ill_retw(cpu_env, tmp);
         tcg_temp_free(tmp);
+        if(dc->retw_distance) {
+            gen_set_label(label);
+        }
         return 0;
     }
 }
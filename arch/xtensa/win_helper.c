@@ -90,15 +90,6 @@ void HELPER(sync_windowbase)(CPUState *env)
     xtensa_rotate_window_abs(env, env->windowbase_next);
 }
 
-void HELPER(entry)(CPUState *env, uint32_t pc, uint32_t s, uint32_t imm)
-{
-    int callinc = (env->sregs[PS] & PS_CALLINC) >> PS_CALLINC_SHIFT;
-
-    env->regs[(callinc << 2) | (s & 3)] = env->regs[s] - imm;
-    env->windowbase_next = env->sregs[WINDOW_BASE] + callinc;
-    env->sregs[WINDOW_START] |= windowstart_bit(env->windowbase_next, env);
-}
-
 void HELPER(window_check)(CPUState *env, uint32_t pc, uint32_t w)
 {
     uint32_t windowbase = windowbase_bound(env->sregs[WINDOW_BASE], env);
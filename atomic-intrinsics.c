@@ -19,20 +19,18 @@ typedef union TCGv_unknown {
 
 #if TCG_TARGET_HAS_INTRINSIC_ATOMICS
 /*
- * Branches to `unalignedLabel` if the given `guestAddress` spans two pages.
+ * Branches to `unalignedLabel` if the given `guestAddress` is not naturally aligned for a `dataSize`-bit access.
+ * Host atomic instructions (CMPXCHG16B, CASP, LDXP/STXP) fault on misaligned operands and a naturally aligned
+ * access can never span two pages, so this also keeps the access within a single translated page.
  */
-static void tcg_gen_brcond_page_spanning_check(TCGv_ptr guestAddress, uint16_t dataSize, int unalignedLabel)
+static void tcg_gen_brcond_unaligned_check(TCGv_ptr guestAddress, uint16_t dataSize, int unalignedLabel)
 {
-    TCGv negatedTargetPageMask = tcg_temp_new();
     TCGv maskedAddress = tcg_temp_new();
 
-    //  if ((addr & ~TARGET_PAGE_MASK) + dataSize - 1) >= TARGET_PAGE_SIZE then goto unalignedLabel
-    tcg_gen_movi_tl(negatedTargetPageMask, ~TARGET_PAGE_MASK);
-    tcg_gen_and_i64(maskedAddress, guestAddress, negatedTargetPageMask);
-    tcg_gen_addi_i64(maskedAddress, maskedAddress, dataSize - 1);
-    tcg_gen_brcondi_i64(TCG_COND_GEU, maskedAddress, TARGET_PAGE_SIZE, unalignedLabel);
+    //  if (addr & (dataSize / 8 - 1)) != 0 then goto unalignedLabel
+    tcg_gen_andi_i64(maskedAddress, guestAddress, dataSize / 8 - 1);
+    tcg_gen_brcondi_i64(TCG_COND_NE, maskedAddress, 0, unalignedLabel);
 
-    tcg_temp_free(negatedTargetPageMask);
     tcg_temp_free(maskedAddress);
 }
 
@@ -45,9 +43,9 @@ static inline void tcg_gen_translate_address_and_fallback_guard(TCGv_hostptr hos
 {
     tlib_assert(size == 128 || size == 64 || size == 32);
 
-    //  If the address spans two pages, it can't be implemented by a single host intrinsic,
+    //  If the address is misaligned (and so possibly spans two pages), it can't be implemented by a single host intrinsic,
     //  will have to fall back on the global memory lock.
-    tcg_gen_brcond_page_spanning_check(guestAddress, size, fallbackLabel);
+    tcg_gen_brcond_unaligned_check(guestAddress, size, fallbackLabel);
 
     /*
      * If address is page-aligned:
@@ -30,8 +30,6 @@
 #include "tlib-alloc.h"
 #include "exports.h"
 
-#define SMC_BITMAP_USE_THRESHOLD 10
-
 CPUState *env;
 extern void *global_retaddr;
 
@@ -39,6 +37,9 @@ static TranslationBlock *tbs;
 static int code_gen_max_blocks;
 TranslationBlock *tb_phys_hash[CODE_GEN_PHYS_HASH_SIZE];
 static int nb_tbs;
+/* set once a block is translated from a page that isn't identity mapped,
+   such a block can't be found through the physical page its pc maps to now */
+static bool tbs_virtually_mapped;
 /* any access to the tbs or the page table must use this lock */
 
 extern uint64_t code_gen_buffer_size;
@@ -51,9 +52,9 @@ CPUState *cpu;
 typedef struct PageDesc {
     /* list of TBs intersecting this ram page */
     TranslationBlock *first_tb;
-    /* in order to optimize self modifying code, we count the number
-       of lookups we do to a given page to use a bitmap */
-    unsigned int code_write_count;
+    /* bytes of the page that TBs were translated from, so that writes to
+       data sharing the page with code don't have to walk the TB list.
+       Freed when a TB is removed and rebuilt on the next write. */
     uint8_t *code_bitmap;
 } PageDesc;
 
@@ -105,6 +106,11 @@ static void *l1_map[V_L1_SIZE];
    The bottom level has pointers to PhysPageDesc.  */
 static void *l1_phys_map[P_L1_SIZE];
 
+/* A bottom level entry of l1_phys_map with this bit set points to a single
+   PhysPageDesc describing the first of its L2_SIZE pages.  The remaining
+   ones differ only by their position, see phys_leaf_materialize.  */
+#define PHYS_LEAF_UNIFORM 1
+
 /* statistics */
 static int tlb_flush_count;
 static int tb_flush_count;
@@ -157,8 +163,10 @@ static void free_all_page_descriptors_inner(void **lp, int level, visitor_functi
         //  why the pointer below does not have to be of type
         //  PageDesc/PhysPageDesc? because it does not change anything from the
         //  free() point of view
-        void *pd = *lp;
-        if(pd) {
+        void *pd = (void *)((uintptr_t)*lp & ~PHYS_LEAF_UNIFORM);
+        if(pd && pd != *lp) {
+            tlib_free(pd);
+        } else if(pd) {
             for(i = 0; i < L2_SIZE; i++) {
                 if(visitor) {
                     visitor(pd, i);
@@ -231,12 +239,11 @@ static inline PageDesc *page_find(tb_page_addr_t index)
     return page_find_alloc(index, 0);
 }
 
-static PhysPageDesc *phys_page_find_alloc(target_phys_addr_t index, int alloc)
+/* Returns the bottom level entry of l1_phys_map for the page index.  */
+static void **phys_leaf_find_alloc(target_phys_addr_t index, int alloc)
 {
-    PhysPageDesc *pd;
     void **lp;
     int i;
-    target_phys_addr_t aligned_index;
 
     /* Level 1.  Always allocated.  */
     lp = l1_phys_map + ((index >> P_L1_SHIFT) & (P_L1_SIZE - 1));
@@ -252,15 +259,70 @@ static PhysPageDesc *phys_page_find_alloc(target_phys_addr_t index, int alloc)
         }
         lp = p + ((index >> (i * L2_BITS)) & (L2_SIZE - 1));
     }
+    return lp;
+}
 
-    pd = *lp;
-    if(pd == NULL) {
-        int i;
+/* RAM and ROM pages of a region are consecutive in the host memory, all the
+   other pages of an IO region share the same phys_offset.  */
+static inline bool phys_offset_is_linear(ram_addr_t phys_offset)
+{
+    return (phys_offset & ~TARGET_PAGE_MASK) <= IO_MEM_ROM || (phys_offset & IO_MEM_ROMD);
+}
 
-        if(!alloc) {
-            return NULL;
+/* Only such leaves can be stored as PHYS_LEAF_UNIFORM.  */
+static inline bool phys_offset_is_uniform(ram_addr_t phys_offset)
+{
+    return phys_offset == IO_MEM_UNASSIGNED || phys_offset_is_linear(phys_offset);
+}
+
+static inline bool phys_leaf_is_uniform(void *leaf)
+{
+    return ((uintptr_t)leaf & PHYS_LEAF_UNIFORM) != 0;
+}
+
+static inline PhysPageDesc *phys_leaf_first(void *leaf)
+{
+    return (PhysPageDesc *)((uintptr_t)leaf & ~PHYS_LEAF_UNIFORM);
+}
+
+static void *phys_leaf_new_uniform(target_phys_addr_t aligned_index)
+{
+    PhysPageDesc *pd = tlib_malloc(sizeof(PhysPageDesc));
+
+    pd->phys_offset = IO_MEM_UNASSIGNED;
+    pd->region_offset = aligned_index << TARGET_PAGE_BITS;
+    pd->flags = (PhysPageDescFlags) { 0 };
+    return (void *)((uintptr_t)pd | PHYS_LEAF_UNIFORM);
+}
+
+/* Replaces a uniform leaf with the descriptors of all its pages.  */
+static PhysPageDesc *phys_leaf_materialize(void **lp)
+{
+    PhysPageDesc *first = phys_leaf_first(*lp);
+    PhysPageDesc *pd;
+    int i;
+
+    pd = tlib_malloc(sizeof(PhysPageDesc) * L2_SIZE);
+    for(i = 0; i < L2_SIZE; i++) {
+        pd[i] = *first;
+        pd[i].region_offset += (ram_addr_t)i << TARGET_PAGE_BITS;
+        if(phys_offset_is_linear(first->phys_offset)) {
+            pd[i].phys_offset += (ram_addr_t)i << TARGET_PAGE_BITS;
         }
+    }
+    tlib_free(first);
+    *lp = pd;
+    return pd;
+}
 
+/* Returns the descriptors of all pages of the leaf, allocating them if needed.  */
+static PhysPageDesc *phys_leaf_pages(void **lp, target_phys_addr_t index)
+{
+    PhysPageDesc *pd = *lp;
+    target_phys_addr_t aligned_index;
+    int i;
+
+    if(pd == NULL) {
         *lp = pd = tlib_malloc(sizeof(PhysPageDesc) * L2_SIZE);
         aligned_index = index & ~(L2_SIZE - 1);
 
@@ -269,9 +331,63 @@ static PhysPageDesc *phys_page_find_alloc(target_phys_addr_t index, int alloc)
             pd[i].region_offset = (aligned_index + i) << TARGET_PAGE_BITS;
             pd[i].flags = (PhysPageDescFlags) { 0 };
         }
+    } else if(phys_leaf_is_uniform(pd)) {
+        pd = phys_leaf_materialize(lp);
     }
+    return pd;
+}
 
-    return pd + (index & (L2_SIZE - 1));
+static PhysPageDesc *phys_page_find_alloc(target_phys_addr_t index, int alloc)
+{
+    void **lp;
+
+    lp = phys_leaf_find_alloc(index, alloc);
+    if(lp == NULL || (*lp == NULL && !alloc)) {
+        return NULL;
+    }
+    return phys_leaf_pages(lp, index) + (index & (L2_SIZE - 1));
+}
+
+/* Calls the visitor for the descriptors of pages [index; last_index] until it
+   returns true.  A leaf covered by the range as a whole that is uniform (or
+   isn't allocated, if alloc is set) stays uniform and is visited only once,
+   with the descriptor of its first page; visitors can modify only the flags
+   then.  Pages that aren't allocated are skipped if alloc isn't set.  */
+void phys_pages_visit_range(target_phys_addr_t index, target_phys_addr_t last_index, bool alloc, PhysPageDescVisitor visitor,
+                            void *opaque)
+{
+    target_phys_addr_t leaf_last;
+    PhysPageDesc *pd;
+    void **lp;
+
+    while(true) {
+        leaf_last = index | (L2_SIZE - 1);
+        lp = phys_leaf_find_alloc(index, alloc);
+        if(lp == NULL || (*lp == NULL && !alloc)) {
+            /* nothing is mapped there */
+        } else if((index & (L2_SIZE - 1)) == 0 && leaf_last <= last_index && (*lp == NULL || phys_leaf_is_uniform(*lp))) {
+            if(*lp == NULL) {
+                *lp = phys_leaf_new_uniform(index);
+            }
+            if(visitor(phys_leaf_first(*lp), opaque)) {
+                return;
+            }
+        } else {
+            pd = phys_leaf_pages(lp, index);
+            for(;; index++) {
+                if(visitor(pd + (index & (L2_SIZE - 1)), opaque)) {
+                    return;
+                }
+                if(index == leaf_last || index == last_index) {
+                    break;
+                }
+            }
+        }
+        if(leaf_last >= last_index) {
+            return;
+        }
+        index = leaf_last + 1;
+    }
 }
 
 inline PhysPageDesc *phys_page_find(target_phys_addr_t index)
@@ -301,6 +417,37 @@ void unmap_page(target_phys_addr_t address)
     tlb_flush_page(cpu, address, /* from_generated: */ false);
 }
 
+static bool unmap_page_visitor(PhysPageDesc *pd, void *opaque)
+{
+    /* uniform leaves keep linear phys_offset, so region_offset stays linear */
+    if(pd->phys_offset != IO_MEM_UNASSIGNED) {
+        pd->region_offset = pd->phys_offset;
+        pd->phys_offset = IO_MEM_UNASSIGNED;
+    }
+    return false;
+}
+
+/* Unmaps pages containing addresses from start to end, inclusive.  */
+void unmap_range(target_phys_addr_t start, target_phys_addr_t end)
+{
+    target_phys_addr_t page, last_page;
+
+    if(start > end) {
+        return;
+    }
+    page = start >> TARGET_PAGE_BITS;
+    last_page = end >> TARGET_PAGE_BITS;
+    phys_pages_visit_range(page, last_page, false, unmap_page_visitor, NULL);
+
+    if(last_page - page >= CPU_TLB_SIZE) {
+        tlb_flush(cpu, 1, false);
+        return;
+    }
+    for(; page <= last_page; page++) {
+        tlb_flush_page(cpu, page << TARGET_PAGE_BITS, /* from_generated: */ false);
+    }
+}
+
 static void tlb_protect_code(ram_addr_t ram_addr);
 static void tlb_unprotect_code_phys(CPUState *env, ram_addr_t ram_addr, target_ulong vaddr);
 #define mmap_lock() \
@@ -442,7 +589,6 @@ static inline void invalidate_page_bitmap(PageDesc *p)
         tlib_free(p->code_bitmap);
         p->code_bitmap = NULL;
     }
-    p->code_write_count = 0;
 }
 
 /* Set to NULL all the 'first_tb' fields in all PageDescs. */
@@ -487,6 +633,7 @@ void tb_flush(CPUState *env1)
     }
 
     nb_tbs = 0;
+    tbs_virtually_mapped = false;
     memset(cpu->tb_jmp_cache, 0, TB_JMP_CACHE_SIZE * sizeof(void *));
     memset(tb_phys_hash, 0, CODE_GEN_PHYS_HASH_SIZE * sizeof(void *));
     page_flush_tb();
@@ -649,9 +796,31 @@ static inline void set_bits(uint8_t *tab, int start, int len)
     }
 }
 
+/* marks the bytes of the n-th page of the TB in the page bitmap */
+static void set_tb_page_bits(PageDesc *p, TranslationBlock *tb, int n)
+{
+    int tb_start, tb_end;
+
+    /* NOTE: this is subtle as a TB may span two physical pages */
+    if(n == EXIT_TB_NO_JUMP) {
+        tb_start = tb->pc & ~TARGET_PAGE_MASK;
+        tb_end = tb_start + tb->size;
+        if(tb_end > TARGET_PAGE_SIZE) {
+            tb_end = TARGET_PAGE_SIZE;
+        } else if(tb_end == tb_start) {
+            //  empty blocks with just a breakpoint are invalidated by writes to their pc
+            tb_end++;
+        }
+    } else {
+        tb_start = 0;
+        tb_end = ((tb->pc + tb->size) & ~TARGET_PAGE_MASK);
+    }
+    set_bits(p->code_bitmap, tb_start, tb_end - tb_start);
+}
+
 static void build_page_bitmap(PageDesc *p)
 {
-    int n, tb_start, tb_end;
+    int n;
     TranslationBlock *tb;
 
     p->code_bitmap = tlib_mallocz(TARGET_PAGE_SIZE / 8);
@@ -660,20 +829,7 @@ static void build_page_bitmap(PageDesc *p)
     while(tb != NULL) {
         n = (uintptr_t)tb & 3;
         tb = (TranslationBlock *)((uintptr_t)tb & ~3);
-        /* NOTE: this is subtle as a TB may span two physical pages */
-        if(n == EXIT_TB_NO_JUMP) {
-            /* NOTE: tb_end may be after the end of the page, but
-               it is not a problem */
-            tb_start = tb->pc & ~TARGET_PAGE_MASK;
-            tb_end = tb_start + tb->size;
-            if(tb_end > TARGET_PAGE_SIZE) {
-                tb_end = TARGET_PAGE_SIZE;
-            }
-        } else {
-            tb_start = 0;
-            tb_end = ((tb->pc + tb->size) & ~TARGET_PAGE_MASK);
-        }
-        set_bits(p->code_bitmap, tb_start, tb_end - tb_start);
+        set_tb_page_bits(p, tb, n);
         tb = tb->page_next[n];
     }
 }
@@ -715,8 +871,10 @@ TranslationBlock *tb_gen_code(CPUState *env, target_ulong pc, target_ulong cs_ba
         virt_page2 = (pc + tb->size - 1) & TARGET_PAGE_MASK;
         if((pc & TARGET_PAGE_MASK) != virt_page2) {
             phys_page2 = get_page_addr_code(env, virt_page2, true);
+            tbs_virtually_mapped |= phys_page2 != virt_page2;
         }
     }
+    tbs_virtually_mapped |= phys_page1 != (pc & TARGET_PAGE_MASK);
     tb_link_page(tb, phys_page1, phys_page2);
     return tb;
 }
@@ -832,10 +990,6 @@ void tb_invalidate_phys_page_range_inner(tb_page_addr_t start, tb_page_addr_t en
     if(!p) {
         return;
     }
-    if(!p->code_bitmap && ++p->code_write_count >= SMC_BITMAP_USE_THRESHOLD && is_cpu_write_access) {
-        /* build code bitmap */
-        build_page_bitmap(p);
-    }
 
     /* we remove all the TBs in the range [start, end[ */
     /* XXX: see if in some cases it could be faster to invalidate all the code */
@@ -954,14 +1108,17 @@ static inline void tb_invalidate_phys_page_fast(tb_page_addr_t start, int len)
     if(!p) {
         return;
     }
-    if(p->code_bitmap) {
-        offset = start & ~TARGET_PAGE_MASK;
-        b = p->code_bitmap[offset >> 3] >> (offset & 7);
-        if(b & ((1 << len) - 1)) {
-            goto do_invalidate;
-        }
-    } else {
-    do_invalidate:
+    if(!p->first_tb) {
+        /* no code left, the slow path unprotects the page */
+        tb_invalidate_phys_page_range(start, start + len, 1);
+        return;
+    }
+    if(!p->code_bitmap) {
+        build_page_bitmap(p);
+    }
+    offset = start & ~TARGET_PAGE_MASK;
+    b = p->code_bitmap[offset >> 3] >> (offset & 7);
+    if(b & ((1 << len) - 1)) {
         tb_invalidate_phys_page_range(start, start + len, 1);
     }
 }
@@ -979,7 +1136,11 @@ static inline void tb_alloc_page(TranslationBlock *tb, unsigned int n, tb_page_a
     tb->page_next[n] = p->first_tb;
     page_already_protected = p->first_tb != NULL;
     p->first_tb = (TranslationBlock *)((uintptr_t)tb | n);
-    invalidate_page_bitmap(p);
+    if(p->code_bitmap) {
+        set_tb_page_bits(p, tb, n);
+    } else {
+        build_page_bitmap(p);
+    }
 
     /* if some code is already present, then the pages are already
        protected. So we handle the case where only the first TB is
@@ -1059,8 +1220,24 @@ TranslationBlock *tb_find_pc(uintptr_t tc_ptr)
 static void breakpoint_invalidate(CPUState *env, target_ulong pc)
 {
     TranslationBlock *tb;
-    tb_page_addr_t physical_addr;
+    tb_page_addr_t phys_page, physical_addr;
+
+    //  Blocks containing the address are found through the block list of its physical page
+    phys_page = get_page_addr_code(env, pc, false);
+    if(phys_page == -1) {
+        phys_page = cpu_get_phys_page_debug(env, pc);
+    }
+    if(phys_page != -1) {
+        physical_addr = phys_page | (pc & ~TARGET_PAGE_MASK);
+        tb_invalidate_phys_page_range_inner(physical_addr, physical_addr + 1, 0, 0);
+        //  That's all of them as long as every block was translated with identity mapping
+        if(!tbs_virtually_mapped) {
+            return;
+        }
+    }
 
+    //  Breakpoints match the virtual pc, so if the address isn't mapped at the moment or address translation is in use,
+    //  blocks translated from it under another mapping (another ASID, MMU on or off) are looked for by their virtual address
     for(int i = 0; i < nb_tbs; ++i) {
         tb = &tbs[i];
         if(pc < tb->pc || tb->pc + tb->size < pc) {
@@ -1072,6 +1249,32 @@ static void breakpoint_invalidate(CPUState *env, target_ulong pc)
     }
 }
 
+static void breakpoint_hash_insert(CPUState *env, CPUBreakpoint *bp)
+{
+    CPUBreakpoint **pbp = &env->breakpoint_hash[bp_hash_func(bp->pc)];
+
+    //  Keep the order of env->breakpoints, GDB-injected breakpoints go in front
+    if(!(bp->flags & BP_GDB)) {
+        while(*pbp != NULL) {
+            pbp = &(*pbp)->hash_next;
+        }
+    }
+    bp->hash_next = *pbp;
+    *pbp = bp;
+    env->breakpoint_page_count[bp_page_hash_func(bp->pc)]++;
+}
+
+static void breakpoint_hash_remove(CPUState *env, CPUBreakpoint *bp)
+{
+    CPUBreakpoint **pbp = &env->breakpoint_hash[bp_hash_func(bp->pc)];
+
+    while(*pbp != bp) {
+        pbp = &(*pbp)->hash_next;
+    }
+    *pbp = bp->hash_next;
+    env->breakpoint_page_count[bp_page_hash_func(bp->pc)]--;
+}
+
 /* Add a breakpoint.  */
 int cpu_breakpoint_insert(CPUState *env, target_ulong pc, int flags, CPUBreakpoint **breakpoint)
 {
@@ -1088,6 +1291,7 @@ int cpu_breakpoint_insert(CPUState *env, target_ulong pc, int flags, CPUBreakpoi
     } else {
         QTAILQ_INSERT_TAIL(&env->breakpoints, bp, entry);
     }
+    breakpoint_hash_insert(env, bp);
 
     breakpoint_invalidate(env, pc);
 
@@ -1205,7 +1409,7 @@ int cpu_breakpoint_remove(CPUState *env, target_ulong pc, int flags)
 {
     CPUBreakpoint *bp;
 
-    QTAILQ_FOREACH(bp, &env->breakpoints, entry) {
+    for(bp = env->breakpoint_hash[bp_hash_func(pc)]; bp != NULL; bp = bp->hash_next) {
         if(bp->pc == pc && bp->flags == flags) {
             cpu_breakpoint_remove_by_ref(env, bp);
             return 0;
@@ -1218,6 +1422,7 @@ int cpu_breakpoint_remove(CPUState *env, target_ulong pc, int flags)
 void cpu_breakpoint_remove_by_ref(CPUState *env, CPUBreakpoint *breakpoint)
 {
     QTAILQ_REMOVE(&env->breakpoints, breakpoint, entry);
+    breakpoint_hash_remove(env, breakpoint);
 
     breakpoint_invalidate(env, breakpoint->pc);
 
@@ -1448,6 +1653,7 @@ void tlb_flush(CPUState *env, int flush_global, bool from_generated_code)
     }
 
     memset(env->tlb_table, 0xFF, CPU_TLB_SIZE * NB_MMU_MODES * sizeof(CPUTLBEntry));
+    memset(env->tlb_attrs, 0xFF, sizeof(env->tlb_attrs));
 
     memset(env->tb_jmp_cache, 0, TB_JMP_CACHE_SIZE * sizeof(void *));
 
@@ -1474,6 +1680,7 @@ void tlb_flush_masked(CPUState *env, uint32_t mmu_indexes_mask)
     for(int mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx += 1) {
         if(extract32(mmu_indexes_mask, mmu_idx, 1)) {
             memset(&env->tlb_table[mmu_idx], 0xFF, CPU_TLB_SIZE * sizeof(CPUTLBEntry));
+            memset(&env->tlb_attrs[mmu_idx], 0xFF, sizeof(env->tlb_attrs[mmu_idx]));
         }
     }
 
@@ -1502,6 +1709,9 @@ void tlb_flush_page_masked(CPUState *env, target_ulong addr, uint32_t mmu_indexe
     for(mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx += 1) {
         if(extract32(mmu_indexes_mask, mmu_idx, 1)) {
             tlb_flush_entry(&env->tlb_table[mmu_idx][i], addr);
+            if((env->tlb_attrs[mmu_idx][i] & TARGET_PAGE_MASK) == addr) {
+                env->tlb_attrs[mmu_idx][i] = -1;
+            }
         }
     }
 
@@ -1567,6 +1777,57 @@ int tlb_fill(CPUState *env, target_ulong addr, int access_type, int mmu_idx, voi
 
 #undef TRY_FILL
 
+/* Return the host address backing the guest virtual address 'addr' if the TLB
+   already maps it as plain RAM for the given access type, NULL otherwise.
+   Never fills the TLB or raises a fault. */
+void *tlb_vaddr_to_host(CPUState *env, target_ulong addr, int access_type, int mmu_idx)
+{
+    int index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    CPUTLBEntry *te = &env->tlb_table[mmu_idx][index];
+    target_ulong tlb_addr;
+
+    switch(access_type) {
+        case ACCESS_DATA_LOAD:
+            tlb_addr = te->addr_read;
+            break;
+        case ACCESS_DATA_STORE:
+            tlb_addr = te->addr_write;
+            break;
+        default:
+            tlb_addr = te->addr_code;
+            break;
+    }
+    if((addr & TARGET_PAGE_MASK) != (tlb_addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
+        return NULL;
+    }
+    //  MMIO and pages which have to be rechecked on every access can't be accessed directly
+    if(tlb_addr & (TLB_MMIO | TLB_ONE_SHOT)) {
+        return NULL;
+    }
+    return (void *)(uintptr_t)(addr + te->addend);
+}
+
+/* Make sure 'size' bytes at 'addr' (not crossing a page) are writable, raising the
+   MMU fault otherwise. Returns the host address if the page is plain RAM without
+   translated code and NULL if the write has to go through the slow path. */
+void *probe_write(CPUState *env, target_ulong addr, int size, int mmu_idx, uintptr_t retaddr)
+{
+    int index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    void *host = tlb_vaddr_to_host(env, addr, ACCESS_DATA_STORE, mmu_idx);
+
+    if(host == NULL) {
+        if(tlb_fill(env, addr, ACCESS_DATA_STORE, mmu_idx, (void *)retaddr, 0, size) != TRANSLATE_SUCCESS) {
+            return NULL;
+        }
+        host = tlb_vaddr_to_host(env, addr, ACCESS_DATA_STORE, mmu_idx);
+    }
+    //  Writes to pages with translated code have to invalidate it
+    if(env->tlb_table[mmu_idx][index].addr_write & TLB_NOTDIRTY) {
+        return NULL;
+    }
+    return host;
+}
+
 /* update the TLB so that writes in physical page 'phys_addr' are no longer
    tested for self modifying code */
 static void tlb_unprotect_code_phys(CPUState *env, ram_addr_t ram_addr, target_ulong vaddr)
@@ -1686,8 +1947,11 @@ static inline int is_io_accessed(CPUState *env, target_ulong vaddr)
 
 /* Add a new TLB entry. At most one entry for a given virtual address
    is permitted. Only a single TARGET_PAGE_SIZE region is mapped, the
-   supplied size is only used by tlb_flush_page.  */
-void tlb_set_page(CPUState *env, target_ulong vaddr, target_phys_addr_t paddr, int prot, int mmu_idx, target_ulong size)
+   supplied size is only used by tlb_flush_page. 'attrs' are target-specific
+   bits below TARGET_PAGE_BITS kept in 'tlb_attrs' for as long as the entry
+   is valid.  */
+void tlb_set_page_with_attrs(CPUState *env, target_ulong vaddr, target_phys_addr_t paddr, int prot, int mmu_idx,
+                             target_ulong size, target_ulong attrs)
 {
     PhysPageDesc *p;
     ram_addr_t pd;
@@ -1767,6 +2031,7 @@ void tlb_set_page(CPUState *env, target_ulong vaddr, target_phys_addr_t paddr, i
 
     index = (vaddr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     env->iotlb[mmu_idx][index] = iotlb - vaddr;
+    env->tlb_attrs[mmu_idx][index] = (vaddr & TARGET_PAGE_MASK) | attrs;
     te = &env->tlb_table[mmu_idx][index];
     te->addend = addend - vaddr;
     if(prot & PAGE_READ) {
@@ -1794,6 +2059,11 @@ void tlb_set_page(CPUState *env, target_ulong vaddr, target_phys_addr_t paddr, i
     }
 }
 
+void tlb_set_page(CPUState *env, target_ulong vaddr, target_phys_addr_t paddr, int prot, int mmu_idx, target_ulong size)
+{
+    tlb_set_page_with_attrs(env, vaddr, paddr, prot, mmu_idx, size, 0);
+}
+
 /* register physical memory.
    For RAM, 'size' must be a multiple of the target page size.
    If (phys_offset & ~TARGET_PAGE_MASK) != 0, then it is an
@@ -1819,6 +2089,30 @@ void cpu_register_physical_memory_log(target_phys_addr_t start_addr, ram_addr_t
 
     addr = start_addr;
     do {
+        /* whole leaves that don't need per-page descriptors are described at once */
+        if(phys_offset_is_uniform(phys_offset) && ((addr >> TARGET_PAGE_BITS) & (L2_SIZE - 1)) == 0 &&
+           (target_phys_addr_t)(end_addr - addr) >= ((target_phys_addr_t)L2_SIZE << TARGET_PAGE_BITS)) {
+            void **lp = phys_leaf_find_alloc(addr >> TARGET_PAGE_BITS, 1);
+
+            if(*lp == NULL || phys_leaf_is_uniform(*lp)) {
+                if(*lp == NULL) {
+                    *lp = phys_leaf_new_uniform(addr >> TARGET_PAGE_BITS);
+                }
+                p = phys_leaf_first(*lp);
+                if(p->phys_offset == IO_MEM_UNASSIGNED) {
+                    p->region_offset = region_offset;
+                    p->flags = (PhysPageDescFlags) { .dirty = true };
+                }
+                p->phys_offset = phys_offset;
+                p->flags.dirty = true;
+                if(phys_offset_is_linear(phys_offset)) {
+                    phys_offset += (ram_addr_t)L2_SIZE << TARGET_PAGE_BITS;
+                }
+                region_offset += (ram_addr_t)L2_SIZE << TARGET_PAGE_BITS;
+                addr += (target_phys_addr_t)L2_SIZE << TARGET_PAGE_BITS;
+                continue;
+            }
+        }
         p = phys_page_find(addr >> TARGET_PAGE_BITS);
         if(p && p->phys_offset != IO_MEM_UNASSIGNED) {
             p->phys_offset = phys_offset;
@@ -1896,7 +2190,7 @@ void notdirty_mem_writel(void *opaque, target_phys_addr_t ram_addr, uint32_t val
 {
     PhysPageDesc *p = phys_page_find(ram_addr >> TARGET_PAGE_BITS);
     if(!p->flags.dirty) {
-        tb_invalidate_phys_page_fast(ram_addr, 2);
+        tb_invalidate_phys_page_fast(ram_addr, 4);
     }
     stl_p(get_ram_ptr(ram_addr), val);
     /* we remove the notdirty callback only if the code has been
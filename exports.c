@@ -438,74 +438,66 @@ EXC_VOID_2(tlib_map_range, uint64_t, start_addr, uint64_t, length)
 
 void tlib_unmap_range(uint64_t start, uint64_t end)
 {
-    uint64_t new_start;
-
-    while(start <= end) {
-        unmap_page(start);
-        new_start = start + TARGET_PAGE_SIZE;
-        if(new_start < start) {
-            return;
-        }
-        start = new_start;
-    }
+    unmap_range(start, end);
 }
 
 EXC_VOID_2(tlib_unmap_range, uint64_t, start, uint64_t, end)
 
+static bool set_access_flags_visitor(PhysPageDesc *pd, void *opaque)
+{
+    pd->flags = *(PhysPageDescFlags *)opaque;
+    return false;
+}
+
 void tlib_register_access_flags_for_range(uint64_t start_address, uint64_t length, uint32_t is_executable_io_mem)
 {
     PhysPageDescFlags flags = {
         .executable_io_mem = is_executable_io_mem ? true : false,
     };
 
-    //  If needed split ranges
-    uint64_t addr = start_address;
-    while(addr < (start_address + length)) {
-        phys_page_alloc(addr >> TARGET_PAGE_BITS, flags);
-        addr += TARGET_PAGE_SIZE;
+    if(length != 0) {
+        phys_pages_visit_range(start_address >> TARGET_PAGE_BITS, (start_address + length - 1) >> TARGET_PAGE_BITS, true,
+                               set_access_flags_visitor, &flags);
     }
     tlib_printf(LOG_LEVEL_DEBUG, "Registering range flags; start_address: 0x%x, length: 0x%x, flags: 0x%x", start_address, length,
                 flags);
 }
 EXC_VOID_3(tlib_register_access_flags_for_range, uint64_t, startAddress, uint64_t, length, uint32_t, is_executable_io_mem)
 
-uint32_t tlib_enable_external_permission_handler_for_range(uint64_t start_address, uint64_t length, uint32_t external_permissions)
+static bool set_external_permissions_visitor(PhysPageDesc *pd, void *opaque)
 {
-    PhysPageDesc *pd;
-
-    uint64_t addr = start_address;
-    while(addr < (start_address + length)) {
-        pd = phys_page_find((target_phys_addr_t)addr >> TARGET_PAGE_BITS);
-        if(pd != NULL) {
-            pd->flags.external_permissions = external_permissions;
-            addr += TARGET_PAGE_SIZE;
-            continue;
-        }
-
-        PhysPageDescFlags flags = {
-            .external_permissions = external_permissions,
-        };
-        pd = phys_page_alloc(addr >> TARGET_PAGE_BITS, flags);
+    pd->flags.external_permissions = *(uint32_t *)opaque;
+    return false;
+}
 
-        addr += TARGET_PAGE_SIZE;
+uint32_t tlib_enable_external_permission_handler_for_range(uint64_t start_address, uint64_t length, uint32_t external_permissions)
+{
+    if(length != 0) {
+        phys_pages_visit_range(start_address >> TARGET_PAGE_BITS, (start_address + length - 1) >> TARGET_PAGE_BITS, true,
+                               set_external_permissions_visitor, &external_permissions);
     }
     return 0;
 }
 EXC_INT_3(uint32_t, tlib_enable_external_permission_handler_for_range, uint64_t, start_address, uint64_t, length, uint32_t,
           external_permissions)
 
+static bool is_mapped_visitor(PhysPageDesc *pd, void *opaque)
+{
+    if(pd->phys_offset != IO_MEM_UNASSIGNED) {
+        *(bool *)opaque = true;
+        return true;
+    }
+    return false;
+}
+
 uint32_t tlib_is_range_mapped(uint64_t start, uint64_t end)
 {
-    PhysPageDesc *pd;
+    bool is_mapped = false;
 
-    while(start < end) {
-        pd = phys_page_find((target_phys_addr_t)start >> TARGET_PAGE_BITS);
-        if(pd != NULL && pd->phys_offset != IO_MEM_UNASSIGNED) {
-            return 1;  //  at least one page of this region is mapped
-        }
-        start += TARGET_PAGE_SIZE;
+    if(start < end) {
+        phys_pages_visit_range(start >> TARGET_PAGE_BITS, (end - 1) >> TARGET_PAGE_BITS, false, is_mapped_visitor, &is_mapped);
     }
-    return 0;
+    return is_mapped;  //  at least one page of this region is mapped
 }
 
 EXC_INT_2(uint32_t, tlib_is_range_mapped, uint64_t, start, uint64_t, end)
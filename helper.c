@@ -4,6 +4,7 @@
 #include "debug.h"
 #include "atomic.h"
 #include "address-translation.h"
+#include "tlib-alloc.h"
 
 //  Dirty addresses handling
 #define MAX_DIRTY_ADDRESSES_LIST_COUNT 100
@@ -112,6 +113,43 @@ void HELPER(try_exit_cpu_loop)(CPUState *env)
     }
 }
 
+//  Finds the next block for `gen_lookup_and_goto_ptr` without leaving the generated code. The header of the returned
+//  block repeats the exit request and instruction limit checks, so only the ones done by `cpu_exec` before
+//  `tb_find_fast` are needed here. Anything else makes it return the epilogue, which exits like `tcg_gen_exit_tb(0)`.
+void *HELPER(lookup_tb_ptr)(CPUState *env)
+{
+    TranslationBlock *tb;
+    target_ulong cs_base, pc;
+    int flags;
+    uint32_t max_icount;
+
+    if(unlikely(env->interrupt_request || env->exit_request || env->tb_restart_request || env->exception_index >= 0 ||
+                env->mmu_fault || env->chaining_disabled || env->tb_cache_disabled)) {
+        return tcg->ctx->code_gen_epilogue;
+    }
+
+    cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
+#ifdef TARGET_PROTO_ARM_M
+    if(pc >= ARM_M_FNC_RETURN_MIN) {
+        //  Exception and Secure function returns are handled in `cpu_exec`
+        return tcg->ctx->code_gen_epilogue;
+    }
+#endif
+
+    tb = env->tb_jmp_cache[tb_jmp_cache_hash_func(pc)];
+    if(unlikely(!tb || tb->pc != pc || tb->cs_base != cs_base || tb->flags != flags)) {
+        return tcg->ctx->code_gen_epilogue;
+    }
+
+    //  Same conditions as in `tb_find_fast`, a block that was cut or is too long has to be found by `tb_find_slow`
+    cpu_sync_instructions_count(env);
+    max_icount = env->instructions_count_limit - env->instructions_count_value;
+    if((tb->was_cut && tb->icount < max_icount) || tb->icount > max_icount) {
+        return tcg->ctx->code_gen_epilogue;
+    }
+    return rw_ptr_to_rx(tb->tc_ptr);
+}
+
 void HELPER(abort)(void)
 {
     tlib_abort("aborted by gen_abort!");
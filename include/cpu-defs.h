@@ -100,6 +100,9 @@ typedef uint64_t target_ulong __attribute__((aligned(TARGET_LONG_ALIGNMENT)));
 #define TB_JMP_CACHE_BITS 12
 #define TB_JMP_CACHE_SIZE (1 << TB_JMP_CACHE_BITS)
 
+#define BP_HASH_BITS 8
+#define BP_HASH_SIZE (1 << BP_HASH_BITS)
+
 #define DEFAULT_EXTERNAL_MMU_RANGE_COUNT 16
 
 /* ARM-M specific magic PC values, which can be used for exception/secure return */
@@ -143,17 +146,21 @@ typedef struct CPUTLBEntry {
 
 extern int CPUTLBEntry_wrong_size[sizeof(CPUTLBEntry) == (1 << CPU_TLB_ENTRY_BITS) ? 1 : -1];
 
-#define CPU_COMMON_TLB                                                \
-    /* The meaning of the MMU modes is defined in the target code. */ \
-    CPUTLBEntry tlb_table[NB_MMU_MODES][CPU_TLB_SIZE];                \
-    target_phys_addr_t iotlb[NB_MMU_MODES][CPU_TLB_SIZE];             \
-    target_ulong tlb_flush_addr;                                      \
+#define CPU_COMMON_TLB                                                    \
+    /* The meaning of the MMU modes is defined in the target code. */     \
+    CPUTLBEntry tlb_table[NB_MMU_MODES][CPU_TLB_SIZE];                    \
+    target_phys_addr_t iotlb[NB_MMU_MODES][CPU_TLB_SIZE];                 \
+    /* Page of the entry ORed with the target-specific attribute bits     \
+       it was filled with, -1 if invalid. See tlb_set_page_with_attrs. */ \
+    target_ulong tlb_attrs[NB_MMU_MODES][CPU_TLB_SIZE];                   \
+    target_ulong tlb_flush_addr;                                          \
     target_ulong tlb_flush_mask;
 
 typedef struct CPUBreakpoint {
     target_ulong pc;
     int flags; /* BP_* */
     QTAILQ_ENTRY(CPUBreakpoint) entry;
+    struct CPUBreakpoint *hash_next; /* next breakpoint in the same bp_hash_func bucket */
 } CPUBreakpoint;
 
 typedef struct CachedAccessDescriptor {
@@ -302,6 +309,10 @@ enum block_interrupt_cause {
     CPU_COMMON_TLB                                                             \
     ExtMmuRange *external_mmu_windows;                                         \
     QTAILQ_HEAD(breakpoints_head, CPUBreakpoint) breakpoints;                  \
+    /* breakpoints hashed by pc, in the same relative order as above */        \
+    struct CPUBreakpoint *breakpoint_hash[BP_HASH_SIZE];                       \
+    /* number of breakpoints on the pages hashed to each slot */               \
+    uint32_t breakpoint_page_count[BP_HASH_SIZE];                              \
     QTAILQ_HEAD(read_cache_head, CachedAccessDescriptor) read_cache;           \
     QTAILQ_HEAD(write_cache_head, CachedAccessDescriptor) write_cache;         \
     struct TranslationBlock *tb_jmp_cache[TB_JMP_CACHE_SIZE];                  \
@@ -62,8 +62,21 @@ void arch_raise_mmu_fault_exception(CPUState *env, int errcode, int access_type,
 //  All the other functions declared in this header are common for all architectures.
 void gen_exit_tb(TranslationBlock *, int);
 void gen_exit_tb_no_chaining(TranslationBlock *);
+void gen_lookup_and_goto_ptr(TranslationBlock *);
 CPUBreakpoint *process_breakpoints(CPUState *env, target_ulong pc);
 
+static inline unsigned int bp_hash_func(target_ulong pc)
+{
+    return (pc ^ (pc >> 2) ^ (pc >> (BP_HASH_BITS + 2))) & (BP_HASH_SIZE - 1);
+}
+
+static inline unsigned int bp_page_hash_func(target_ulong pc)
+{
+    target_ulong page = pc >> TARGET_PAGE_BITS;
+
+    return (page ^ (page >> BP_HASH_BITS)) & (BP_HASH_SIZE - 1);
+}
+
 void cpu_gen_code(CPUState *env, struct TranslationBlock *tb, int *gen_code_size_ptr, int *search_size_ptr);
 int cpu_get_data_for_pc(CPUState *env, TranslationBlock *tb, uintptr_t searched_pc, bool pc_is_host,
                         target_ulong data[TARGET_INSN_START_WORDS], bool skip_current_instruction);
@@ -84,7 +97,11 @@ void tlb_flush_masked(CPUState *env, uint32_t mmu_indexes_mask);
 void tlb_flush_page(CPUState *env, target_ulong addr, bool from_generated_code);
 void tlb_flush_page_masked(CPUState *env, target_ulong addr, uint32_t mmu_indexes_mask, bool from_generated_code);
 int tlb_fill(CPUState *env, target_ulong addr, int is_write, int mmu_idx, void *retaddr, int no_page_fault, int access_width);
+void *tlb_vaddr_to_host(CPUState *env, target_ulong addr, int access_type, int mmu_idx);
+void *probe_write(CPUState *env, target_ulong addr, int size, int mmu_idx, uintptr_t retaddr);
 void tlb_set_page(CPUState *env, target_ulong vaddr, target_phys_addr_t paddr, int prot, int mmu_idx, target_ulong size);
+void tlb_set_page_with_attrs(CPUState *env, target_ulong vaddr, target_phys_addr_t paddr, int prot, int mmu_idx,
+                             target_ulong size, target_ulong attrs);
 void interrupt_current_translation_block(CPUState *env, int exception_type);
 void interrupt_current_translation_block_from_current_instruction(CPUState *env, int exception_type);
 int get_external_mmu_phys_addr(CPUState *env, uint64_t address, int access_type, target_phys_addr_t *phys_ptr, int *prot,
@@ -373,11 +390,16 @@ CPUDebugExcpHandler *cpu_set_debug_excp_handler(CPUDebugExcpHandler *handler);
 /* cpu-exec.c */
 PhysPageDesc *phys_page_find(target_phys_addr_t index);
 PhysPageDesc *phys_page_alloc(target_phys_addr_t index, PhysPageDescFlags flags);
+/* Returns true to stop the iteration.  */
+typedef bool (*PhysPageDescVisitor)(PhysPageDesc *pd, void *opaque);
+void phys_pages_visit_range(target_phys_addr_t index, target_phys_addr_t last_index, bool alloc, PhysPageDescVisitor visitor,
+                            void *opaque);
 
 void tb_invalidate_phys_page_range_inner(tb_page_addr_t start, tb_page_addr_t end, int is_cpu_write_access, int broadcast);
 void tb_invalidate_phys_page_range_checked(tb_page_addr_t start, tb_page_addr_t end, int is_cpu_write_access, int broadcast);
 
 extern void unmap_page(target_phys_addr_t address);
+void unmap_range(target_phys_addr_t start, target_phys_addr_t end);
 void free_all_page_descriptors(void);
 void code_gen_free(void);
 
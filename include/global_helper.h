@@ -4,6 +4,7 @@ DEF_HELPER_1(prepare_block_for_execution, i32, ptr)
 DEF_HELPER_0(block_begin_event, i32)
 DEF_HELPER_2(block_finished_event, void, tl, i32)
 DEF_HELPER_1(try_exit_cpu_loop, void, env)
+DEF_HELPER_1(lookup_tb_ptr, ptr, env)
 DEF_HELPER_2(log, void, i32, i64)
 DEF_HELPER_1(var_log, void, tl)
 DEF_HELPER_0(abort, void)
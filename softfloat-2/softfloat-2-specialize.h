@@ -165,6 +165,20 @@ typedef struct {
     uint64_t high, low;
 } commonNaNT;
 
+/*----------------------------------------------------------------------------
+ | Returns 1 if the half-precision floating-point value `a' is a quiet
+ | NaN; otherwise returns 0.
+ *----------------------------------------------------------------------------*/
+
+int float16_is_quiet_nan(float16 a_ STATUS_PARAM)
+{
+    if(no_signaling_nans(status)) {
+        return float16_is_any_nan(a_);
+    }
+    uint16_t a = float16_val(a_);
+    return (0xFC00 <= (uint16_t)(a << 1));
+}
+
 /*----------------------------------------------------------------------------
  | Returns 1 if the half-precision floating-point value `a' is a signaling
  | NaN; otherwise returns 0.
@@ -513,6 +527,91 @@ static int pickNaNMulAdd(flag aIsQNaN, flag aIsSNaN, flag bIsQNaN, flag bIsSNaN,
 }
 #endif
 
+/*----------------------------------------------------------------------------
+ | Takes two half-precision floating-point values `a' and `b', one of which
+ | is a NaN, and returns the appropriate NaN result.  If either `a' or `b' is a
+ | signaling NaN, the invalid exception is raised.
+ *----------------------------------------------------------------------------*/
+
+static float16 propagateFloat16NaN(float16 a, float16 b STATUS_PARAM)
+{
+    flag aIsQuietNaN, aIsSignalingNaN, bIsQuietNaN, bIsSignalingNaN;
+    flag aIsLargerSignificand;
+    uint16_t av, bv;
+
+    aIsQuietNaN = float16_is_quiet_nan(a STATUS_VAR);
+    aIsSignalingNaN = float16_is_signaling_nan(a STATUS_VAR);
+    bIsQuietNaN = float16_is_quiet_nan(b STATUS_VAR);
+    bIsSignalingNaN = float16_is_signaling_nan(b STATUS_VAR);
+    av = float16_val(a);
+    bv = float16_val(b);
+
+    if(aIsSignalingNaN | bIsSignalingNaN) {
+        float_raise(float_flag_invalid STATUS_VAR);
+    }
+
+    if(STATUS(default_nan_mode)) {
+        return float16_default_nan;
+    }
+
+    if((uint16_t)(av << 1) < (uint16_t)(bv << 1)) {
+        aIsLargerSignificand = 0;
+    } else if((uint16_t)(bv << 1) < (uint16_t)(av << 1)) {
+        aIsLargerSignificand = 1;
+    } else {
+        aIsLargerSignificand = (av < bv) ? 1 : 0;
+    }
+
+    if(pickNaN(aIsQuietNaN, aIsSignalingNaN, bIsQuietNaN, bIsSignalingNaN, aIsLargerSignificand STATUS_VAR)) {
+        return float16_maybe_silence_nan(b STATUS_VAR);
+    } else {
+        return float16_maybe_silence_nan(a STATUS_VAR);
+    }
+}
+
+/*----------------------------------------------------------------------------
+ | Takes three half-precision floating-point values `a', `b' and `c', one of
+ | which is a NaN, and returns the appropriate NaN result.  If any of `a', `b'
+ | or `c' is a signaling NaN, the invalid exception is raised.  The input
+ | infzero indicates whether a*b was 0*inf or inf*0.
+ *----------------------------------------------------------------------------*/
+
+static float16 propagateFloat16MulAddNaN(float16 a, float16 b, float16 c, flag infzero STATUS_PARAM)
+{
+    flag aIsQuietNaN, aIsSignalingNaN, bIsQuietNaN, bIsSignalingNaN, cIsQuietNaN, cIsSignalingNaN;
+    int which;
+
+    aIsQuietNaN = float16_is_quiet_nan(a STATUS_VAR);
+    aIsSignalingNaN = float16_is_signaling_nan(a STATUS_VAR);
+    bIsQuietNaN = float16_is_quiet_nan(b STATUS_VAR);
+    bIsSignalingNaN = float16_is_signaling_nan(b STATUS_VAR);
+    cIsQuietNaN = float16_is_quiet_nan(c STATUS_VAR);
+    cIsSignalingNaN = float16_is_signaling_nan(c STATUS_VAR);
+
+    if(aIsSignalingNaN | bIsSignalingNaN | cIsSignalingNaN) {
+        float_raise(float_flag_invalid STATUS_VAR);
+    }
+
+    which = pickNaNMulAdd(aIsQuietNaN, aIsSignalingNaN, bIsQuietNaN, bIsSignalingNaN, cIsQuietNaN, cIsSignalingNaN,
+                          infzero STATUS_VAR);
+
+    if(STATUS(default_nan_mode)) {
+        return float16_default_nan;
+    }
+
+    switch(which) {
+        case 0:
+            return float16_maybe_silence_nan(a STATUS_VAR);
+        case 1:
+            return float16_maybe_silence_nan(b STATUS_VAR);
+        case 2:
+            return float16_maybe_silence_nan(c STATUS_VAR);
+        case 3:
+        default:
+            return float16_default_nan;
+    }
+}
+
 /*----------------------------------------------------------------------------
  | Takes two single-precision floating-point values `a' and `b', one of which
  | is a NaN, and returns the appropriate NaN result.  If either `a' or `b' is a
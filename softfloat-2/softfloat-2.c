@@ -77,6 +77,7 @@
 /* softfloat (and in particular the code in softfloat-specialize.h) is
  * target-dependent and needs the TARGET_* macros.
  */
+#include <math.h>
 #include "softfloat-2.h"
 
 /*----------------------------------------------------------------------------
@@ -138,6 +139,21 @@ INLINE flag extractFloat16Sign(float16 a)
     return float16_val(a) >> 15;
 }
 
+/*----------------------------------------------------------------------------
+ | If `a' is denormal and we are in flush-to-zero mode then set the
+ | input-denormal exception and return zero. Otherwise just return the value.
+ *----------------------------------------------------------------------------*/
+float16 float16_squash_input_denormal(float16 a STATUS_PARAM)
+{
+    if(STATUS(flush_inputs_to_zero)) {
+        if(extractFloat16Exp(a) == 0 && extractFloat16Frac(a) != 0) {
+            float_raise(float_flag_input_denormal STATUS_VAR);
+            return make_float16(float16_val(a) & 0x8000);
+        }
+    }
+    return a;
+}
+
 /*----------------------------------------------------------------------------
  | Takes a 64-bit fixed-point value `absZ' with binary point between bits 6
  | and 7, and returns the properly rounded 32-bit integer corresponding to the
@@ -3100,6 +3116,97 @@ static float16 packFloat16(flag zSign, int16 zExp, uint16_t zSig)
     return make_float16((((uint32_t)zSign) << 15) + (((uint32_t)zExp & 0x1F) << 10) + zSig);
 }
 
+/*----------------------------------------------------------------------------
+ | Takes an abstract floating-point value having sign `zSign', exponent `zExp',
+ | and significand `zSig', and returns the proper half-precision floating-
+ | point value corresponding to the abstract input.  The layout of `zSig' is
+ | the same as for `roundAndPackFloat32': the binary point lies between bits
+ | 30 and 29, so the low 20 bits are the ones rounded away.  `zExp' must be 1
+ | less than the ``true'' floating-point exponent.  If `ieee' is 0 the result
+ | uses the ARM alternative half-precision format, which has no infinities or
+ | NaNs; overflow then saturates and raises the invalid exception instead.
+ *----------------------------------------------------------------------------*/
+
+static float16 roundAndPackFloat16(flag zSign, int16 zExp, uint32_t zSig, flag ieee STATUS_PARAM)
+{
+    int8 roundingMode;
+    flag roundNearestEven;
+    uint32_t roundIncrement, roundBits;
+    int16 maxExp;
+    flag isTiny;
+
+    roundingMode = STATUS(float_rounding_mode);
+    roundNearestEven = (roundingMode == float_round_nearest_even);
+    roundIncrement = 0x80000;
+    if(!roundNearestEven && roundingMode != float_round_ties_away) {
+        if(roundingMode == float_round_to_zero) {
+            roundIncrement = 0;
+        } else {
+            roundIncrement = 0xFFFFF;
+            if(zSign) {
+                if(roundingMode == float_round_up) {
+                    roundIncrement = 0;
+                }
+            } else {
+                if(roundingMode == float_round_down) {
+                    roundIncrement = 0;
+                }
+            }
+        }
+    }
+    roundBits = zSig & 0xFFFFF;
+    maxExp = ieee ? 0x1D : 0x1E;
+    if(maxExp <= (uint16_t)zExp) {
+        if((maxExp < zExp) || ((zExp == maxExp) && ((int32_t)(zSig + roundIncrement) < 0))) {
+            if(!ieee) {
+                float_raise(float_flag_invalid STATUS_VAR);
+                return packFloat16(zSign, 0x1F, 0x3FF);
+            }
+            float_raise(float_flag_overflow | float_flag_inexact STATUS_VAR);
+            if(roundIncrement == 0) {
+                return packFloat16(zSign, 0x1E, 0x3FF);
+            }
+            return packFloat16(zSign, 0x1F, 0);
+        }
+        if(zExp < 0) {
+            if(STATUS(flush_to_zero)) {
+                float_raise((int8)float_flag_output_denormal STATUS_VAR);
+                return packFloat16(zSign, 0, 0);
+            }
+            isTiny = (STATUS(float_detect_tininess) == float_tininess_before_rounding) || (zExp < -1) ||
+                     (zSig + roundIncrement < 0x80000000);
+            shift32RightJamming(zSig, -zExp, &zSig);
+            zExp = 0;
+            roundBits = zSig & 0xFFFFF;
+            if(isTiny && roundBits) {
+                float_raise(float_flag_underflow STATUS_VAR);
+            }
+        }
+    }
+    if(roundBits) {
+        STATUS(float_exception_flags) |= float_flag_inexact;
+    }
+    zSig = (zSig + roundIncrement) >> 20;
+    zSig &= ~(((roundBits ^ 0x80000) == 0) & roundNearestEven);
+    if(zSig == 0) {
+        zExp = 0;
+    }
+    return packFloat16(zSign, zExp, zSig);
+}
+
+/*----------------------------------------------------------------------------
+ | Same as `roundAndPackFloat16' except that `zSig' does not have to be
+ | normalized.  Bit 31 of `zSig' must be zero.
+ *----------------------------------------------------------------------------*/
+
+static float16 normalizeRoundAndPackFloat16(flag zSign, int16 zExp, uint32_t zSig, flag ieee STATUS_PARAM)
+{
+    int8 shiftCount;
+
+    shiftCount = countLeadingZeros32(zSig) - 1;
+    return roundAndPackFloat16(zSign, zExp - shiftCount, zSig << shiftCount, ieee STATUS_VAR);
+}
+
 /* Half precision floats come in two formats: standard IEEE and "ARM" format.
    The latter gains extra exponent range by omitting the NaN/Inf encodings.  */
 
@@ -3133,14 +3240,41 @@ float32 float16_to_float32(float16 a, flag ieee STATUS_PARAM)
     return packFloat32(aSign, aExp + 0x70, aSig << 13);
 }
 
+float64 float16_to_float64(float16 a, flag ieee STATUS_PARAM)
+{
+    flag aSign;
+    int16 aExp;
+    uint32_t aSig;
+
+    aSign = extractFloat16Sign(a);
+    aExp = extractFloat16Exp(a);
+    aSig = extractFloat16Frac(a);
+
+    if(aExp == 0x1f && ieee) {
+        if(aSig) {
+            return commonNaNToFloat64(float16ToCommonNaN(a STATUS_VAR) STATUS_VAR);
+        }
+        return packFloat64(aSign, 0x7ff, 0);
+    }
+    if(aExp == 0) {
+        int8 shiftCount;
+
+        if(aSig == 0) {
+            return packFloat64(aSign, 0, 0);
+        }
+
+        shiftCount = countLeadingZeros32(aSig) - 21;
+        aSig = aSig << shiftCount;
+        aExp = -shiftCount;
+    }
+    return packFloat64(aSign, aExp + 0x3f0, ((uint64_t)aSig) << 42);
+}
+
 float16 float32_to_float16(float32 a, flag ieee STATUS_PARAM)
 {
     flag aSign;
     int16 aExp;
     uint32_t aSig;
-    uint32_t mask;
-    uint32_t increment;
-    int8 roundingMode;
     a = float32_squash_input_denormal(a STATUS_VAR);
 
     aSig = extractFloat32Frac(a);
@@ -3149,11 +3283,11 @@ float16 float32_to_float16(float32 a, flag ieee STATUS_PARAM)
     if(aExp == 0xFF) {
         if(aSig) {
             /* Input is a NaN */
-            float16 r = commonNaNToFloat16(float32ToCommonNaN(a STATUS_VAR) STATUS_VAR);
             if(!ieee) {
+                float_raise(float_flag_invalid STATUS_VAR);
                 return packFloat16(aSign, 0, 0);
             }
-            return r;
+            return commonNaNToFloat16(float32ToCommonNaN(a STATUS_VAR) STATUS_VAR);
         }
         /* Infinity */
         if(!ieee) {
@@ -3162,90 +3296,339 @@ float16 float32_to_float16(float32 a, flag ieee STATUS_PARAM)
         }
         return packFloat16(aSign, 0x1f, 0);
     }
-    if(aExp == 0 && aSig == 0) {
-        return packFloat16(aSign, 0, 0);
-    }
-    /* Decimal point between bits 22 and 23.  */
-    aSig |= 0x00800000;
-    aExp -= 0x7f;
-    if(aExp < -14) {
-        mask = 0x00ffffff;
-        if(aExp >= -24) {
-            mask >>= 25 + aExp;
+    if(aExp == 0) {
+        if(aSig == 0) {
+            return packFloat16(aSign, 0, 0);
         }
+        aExp = 1;
     } else {
-        mask = 0x00001fff;
+        aSig |= 0x00800000;
     }
-    if(aSig & mask) {
-        float_raise(float_flag_underflow STATUS_VAR);
-        roundingMode = STATUS(float_rounding_mode);
-        switch(roundingMode) {
-            case float_round_nearest_even:
-                increment = (mask + 1) >> 1;
-                if((aSig & mask) == increment) {
-                    increment = aSig & (increment << 1);
-                }
-                break;
-            case float_round_up:
-                increment = aSign ? 0 : mask;
-                break;
-            case float_round_down:
-                increment = aSign ? mask : 0;
-                break;
-            default: /* round_to_zero */
-                increment = 0;
-                break;
+    return roundAndPackFloat16(aSign, aExp - 0x71, aSig << 7, ieee STATUS_VAR);
+}
+
+float16 float64_to_float16(float64 a, flag ieee STATUS_PARAM)
+{
+    flag aSign;
+    int16 aExp;
+    uint64_t aSig;
+    uint32_t zSig;
+    a = float64_squash_input_denormal(a STATUS_VAR);
+
+    aSig = extractFloat64Frac(a);
+    aExp = extractFloat64Exp(a);
+    aSign = extractFloat64Sign(a);
+    if(aExp == 0x7FF) {
+        if(aSig) {
+            /* Input is a NaN */
+            if(!ieee) {
+                float_raise(float_flag_invalid STATUS_VAR);
+                return packFloat16(aSign, 0, 0);
+            }
+            return commonNaNToFloat16(float64ToCommonNaN(a STATUS_VAR) STATUS_VAR);
         }
-        aSig += increment;
-        if(aSig >= 0x01000000) {
-            aSig >>= 1;
-            aExp++;
+        /* Infinity */
+        if(!ieee) {
+            float_raise(float_flag_invalid STATUS_VAR);
+            return packFloat16(aSign, 0x1f, 0x3ff);
         }
-    } else if(aExp < -14 && STATUS(float_detect_tininess) == float_tininess_before_rounding) {
-        float_raise(float_flag_underflow STATUS_VAR);
+        return packFloat16(aSign, 0x1f, 0);
     }
-
-    if(ieee) {
-        if(aExp > 15) {
-            float_raise(float_flag_overflow | float_flag_inexact STATUS_VAR);
-            return packFloat16(aSign, 0x1f, 0);
+    if(aExp == 0) {
+        if(aSig == 0) {
+            return packFloat16(aSign, 0, 0);
         }
+        aExp = 1;
     } else {
-        if(aExp > 16) {
-            float_raise(float_flag_invalid | float_flag_inexact STATUS_VAR);
-            return packFloat16(aSign, 0x1f, 0x3ff);
-        }
+        aSig |= LIT64(0x0010000000000000);
     }
-    if(aExp < -24) {
-        return packFloat16(aSign, 0, 0);
+    shift64RightJamming(aSig, 22, &aSig);
+    zSig = aSig;
+    return roundAndPackFloat16(aSign, aExp - 0x3F1, zSig, ieee STATUS_VAR);
+}
+
+/*----------------------------------------------------------------------------
+ | Half-precision arithmetic.  Every half-precision value is exactly
+ | representable in double precision, and so is the exact sum, difference or
+ | product of any two of them, so these operations are carried out on the
+ | widened operands and the result is rounded only once when it is narrowed
+ | back.  Quotients and square roots are rounded twice, which is harmless
+ | because the double-precision significand has more than twice as many bits
+ | as the half-precision one plus two.  NaN operands are resolved before
+ | widening so that the target's NaN selection applies to the half-precision
+ | payloads.
+ |
+ | For finite operands the widened operation is done with the host's double
+ | arithmetic.  A quotient or square root of half-precision values that isn't
+ | exact is neither a half-precision value nor halfway between two of them,
+ | even after the host rounds it in whatever mode, so narrowing the host
+ | result in the guest rounding mode still rounds correctly and raises the
+ | right flags.  Zero results go through the software path, as their sign
+ | depends on the guest rounding mode.
+ *----------------------------------------------------------------------------*/
+
+typedef union {
+    float64 s;
+    double h;
+} float64_host_t;
+
+static inline double float16_to_host_double(float16 a STATUS_PARAM)
+{
+    float64_host_t u;
+
+    u.s = float16_to_float64(a, 1 STATUS_VAR);
+    return u.h;
+}
+
+static inline float16 host_double_to_float16(double a STATUS_PARAM)
+{
+    float64_host_t u;
+
+    u.h = a;
+    return float64_to_float16(u.s, 1 STATUS_VAR);
+}
+
+#define FLOAT16_WIDENED_OP(name, op, host_operands)                                                              \
+    float16 float16_##name(float16 a, float16 b STATUS_PARAM)                                                    \
+    {                                                                                                            \
+        float64 z;                                                                                               \
+        double h;                                                                                                \
+        a = float16_squash_input_denormal(a STATUS_VAR);                                                         \
+        b = float16_squash_input_denormal(b STATUS_VAR);                                                         \
+        if(float16_is_any_nan(a) || float16_is_any_nan(b)) {                                                     \
+            return propagateFloat16NaN(a, b STATUS_VAR);                                                         \
+        }                                                                                                        \
+        if(host_operands) {                                                                                      \
+            h = float16_to_host_double(a STATUS_VAR) op float16_to_host_double(b STATUS_VAR);                    \
+            if(h != 0) {                                                                                         \
+                return host_double_to_float16(h STATUS_VAR);                                                     \
+            }                                                                                                    \
+        }                                                                                                        \
+        z = float64_##name(float16_to_float64(a, 1 STATUS_VAR), float16_to_float64(b, 1 STATUS_VAR) STATUS_VAR); \
+        return float64_to_float16(z, 1 STATUS_VAR);                                                              \
     }
-    if(aExp < -14) {
-        aSig >>= -14 - aExp;
-        aExp = -14;
+
+FLOAT16_WIDENED_OP(add, +, !float16_is_infinity(a) && !float16_is_infinity(b))
+FLOAT16_WIDENED_OP(sub, -, !float16_is_infinity(a) && !float16_is_infinity(b))
+FLOAT16_WIDENED_OP(mul, *, !float16_is_infinity(a) && !float16_is_infinity(b))
+FLOAT16_WIDENED_OP(div, /, !float16_is_infinity(a) && !float16_is_infinity(b) && !float16_is_zero(b))
+
+float16 float16_sqrt(float16 a STATUS_PARAM)
+{
+    a = float16_squash_input_denormal(a STATUS_VAR);
+    if(float16_is_any_nan(a)) {
+        return propagateFloat16NaN(a, a STATUS_VAR);
+    }
+    if(!float16_is_neg(a) && !float16_is_infinity(a) && !float16_is_zero(a)) {
+        return host_double_to_float16(sqrt(float16_to_host_double(a STATUS_VAR)) STATUS_VAR);
     }
-    return packFloat16(aSign, aExp + 14, aSig >> 13);
+    return float64_to_float16(float64_sqrt(float16_to_float64(a, 1 STATUS_VAR) STATUS_VAR), 1 STATUS_VAR);
 }
 
-float16 float64_to_float16(float64 a, flag ieee STATUS_PARAM)
+/*----------------------------------------------------------------------------
+ | Returns the result of multiplying the half-precision values `a' and `b'
+ | then adding `c', with no intermediate rounding step after the
+ | multiplication.  The product is exact in double precision, so only the
+ | addition can round; it is done rounding to odd, which keeps enough sticky
+ | information for the final narrowing to round correctly in any mode.
+ *----------------------------------------------------------------------------*/
+
+float16 float16_muladd(float16 a, float16 b, float16 c, int flags STATUS_PARAM)
+{
+    int8 roundingMode;
+    int savedFlags;
+    flag infzero;
+    float64 wa, wb, wc, z;
+
+    a = float16_squash_input_denormal(a STATUS_VAR);
+    b = float16_squash_input_denormal(b STATUS_VAR);
+    c = float16_squash_input_denormal(c STATUS_VAR);
+
+    if(float16_is_any_nan(a) || float16_is_any_nan(b) || float16_is_any_nan(c)) {
+        infzero = (float16_is_zero(a) && float16_is_infinity(b)) || (float16_is_infinity(a) && float16_is_zero(b));
+        return propagateFloat16MulAddNaN(a, b, c, infzero STATUS_VAR);
+    }
+
+    wa = float16_to_float64(a, 1 STATUS_VAR);
+    wb = float16_to_float64(b, 1 STATUS_VAR);
+    wc = float16_to_float64(c, 1 STATUS_VAR);
+
+    roundingMode = STATUS(float_rounding_mode);
+    savedFlags = STATUS(float_exception_flags);
+    STATUS(float_rounding_mode) = float_round_to_zero;
+    STATUS(float_exception_flags) = 0;
+    z = float64_muladd(wa, wb, wc, flags STATUS_VAR);
+    STATUS(float_rounding_mode) = roundingMode;
+    if(STATUS(float_exception_flags) & float_flag_inexact) {
+        z = make_float64(float64_val(z) | 1);
+    } else if(float64_is_zero(z)) {
+        /* The sign of an exact zero depends on the rounding mode. */
+        z = float64_muladd(wa, wb, wc, flags STATUS_VAR);
+    }
+    STATUS(float_exception_flags) = savedFlags | (STATUS(float_exception_flags) & ~float_flag_inexact);
+
+    return float64_to_float16(z, 1 STATUS_VAR);
+}
+
+/*----------------------------------------------------------------------------
+ | Rounds the half-precision floating-point value `a' to an integer, and
+ | returns the result as a half-precision floating-point value.  The
+ | operation is performed according to the IEC/IEEE Standard for Binary
+ | Floating-Point Arithmetic.
+ *----------------------------------------------------------------------------*/
+
+float16 float16_round_to_int(float16 a STATUS_PARAM)
 {
     flag aSign;
     int16 aExp;
-    uint64_t aFrac;
-    a = float64_squash_input_denormal(a STATUS_VAR);
+    uint16_t lastBitMask, roundBitsMask;
+    int8 roundingMode;
+    uint16_t z;
+    a = float16_squash_input_denormal(a STATUS_VAR);
 
-    aFrac = extractFloat64Frac(a);
-    aExp = extractFloat64Exp(a);
-    aSign = extractFloat64Sign(a);
-    if(aExp == 0x7FF) {
-        if(aFrac) {
-            return commonNaNToFloat16(float64ToCommonNaN(a STATUS_VAR) STATUS_VAR);  //  NaN
+    aExp = extractFloat16Exp(a);
+    if(0x19 <= aExp) {
+        if((aExp == 0x1F) && extractFloat16Frac(a)) {
+            return propagateFloat16NaN(a, a STATUS_VAR);
         }
-        return packFloat16(aSign, 0xFF, 0);  //  Infinity
+        return a;
     }
-    if(aExp > 0x40F) {
-        return packFloat16(aSign, 0xFF, 0);  //  Infinity
+    if(aExp <= 0x0E) {
+        if((uint16_t)(float16_val(a) << 1) == 0) {
+            return a;
+        }
+        STATUS(float_exception_flags) |= float_flag_inexact;
+        aSign = extractFloat16Sign(a);
+        switch(STATUS(float_rounding_mode)) {
+            case float_round_nearest_even:
+                if(!extractFloat16Frac(a)) {
+                    break;
+                }
+                __attribute__((fallthrough));
+            case float_round_ties_away:
+                if(aExp == 0x0E) {
+                    return packFloat16(aSign, 0x0F, 0);
+                }
+                break;
+            case float_round_down:
+                return make_float16(aSign ? 0xBC00 : 0);
+            case float_round_up:
+                return make_float16(aSign ? 0x8000 : 0x3C00);
+        }
+        return packFloat16(aSign, 0, 0);
     }
-    return packFloat16(aSign, aExp | ((aExp & 0x400) >> 6), aFrac >> 42);
+    lastBitMask = 1;
+    lastBitMask <<= 0x19 - aExp;
+    roundBitsMask = lastBitMask - 1;
+    z = float16_val(a);
+    roundingMode = STATUS(float_rounding_mode);
+    if(roundingMode == float_round_nearest_even) {
+        z += lastBitMask >> 1;
+        if((z & roundBitsMask) == 0) {
+            z &= ~lastBitMask;
+        }
+    } else if(roundingMode == float_round_ties_away) {
+        z += lastBitMask >> 1;
+    } else if(roundingMode != float_round_to_zero) {
+        if(extractFloat16Sign(make_float16(z)) ^ (roundingMode == float_round_up)) {
+            z += roundBitsMask;
+        }
+    }
+    z &= ~roundBitsMask;
+    if(z != float16_val(a)) {
+        STATUS(float_exception_flags) |= float_flag_inexact;
+    }
+    return make_float16(z);
+}
+
+/*----------------------------------------------------------------------------
+ | Half-precision to integer conversions.  The operand is widened exactly and
+ | handed to the matching single- or double-precision routine.
+ *----------------------------------------------------------------------------*/
+
+#define FLOAT16_TO_INT(type, name, via)                                       \
+    type float16_to_##name(float16 a STATUS_PARAM)                            \
+    {                                                                         \
+        a = float16_squash_input_denormal(a STATUS_VAR);                      \
+        return via##_to_##name(float16_to_##via(a, 1 STATUS_VAR) STATUS_VAR); \
+    }
+
+FLOAT16_TO_INT(int16, int16, float32)
+FLOAT16_TO_INT(int16, int16_round_to_zero, float32)
+FLOAT16_TO_INT(uint16, uint16, float32)
+FLOAT16_TO_INT(uint16, uint16_round_to_zero, float32)
+FLOAT16_TO_INT(int32, int32, float32)
+FLOAT16_TO_INT(int32, int32_round_to_zero, float32)
+FLOAT16_TO_INT(uint32, uint32, float32)
+FLOAT16_TO_INT(uint32, uint32_round_to_zero, float32)
+FLOAT16_TO_INT(int64, int64, float32)
+FLOAT16_TO_INT(int64, int64_round_to_zero, float32)
+FLOAT16_TO_INT(uint64, uint64, float64)
+FLOAT16_TO_INT(uint64, uint64_round_to_zero, float64)
+
+/*----------------------------------------------------------------------------
+ | Returns the result of converting the integer with sign `zSign' and
+ | magnitude `absA', multiplied by 2 raised to the power `scale', to the
+ | half-precision floating-point format.  The value is rounded only once.
+ *----------------------------------------------------------------------------*/
+
+static float16 uint64ToScaledFloat16(flag zSign, uint64_t absA, int scale STATUS_PARAM)
+{
+    int8 shiftCount;
+
+    if(absA == 0) {
+        return packFloat16(zSign, 0, 0);
+    }
+    if(scale > 0x200) {
+        scale = 0x200;
+    } else if(scale < -0x200) {
+        scale = -0x200;
+    }
+    shiftCount = countLeadingZeros64(absA) - 33;
+    if(shiftCount < 0) {
+        shift64RightJamming(absA, -shiftCount, &absA);
+    } else {
+        absA <<= shiftCount;
+    }
+    return roundAndPackFloat16(zSign, 0x2C - shiftCount + scale, absA, 1 STATUS_VAR);
+}
+
+float16 int64_to_float16_scalbn(int64 a, int scale STATUS_PARAM)
+{
+    flag zSign = (a < 0);
+
+    return uint64ToScaledFloat16(zSign, zSign ? -(uint64_t)a : a, scale STATUS_VAR);
+}
+
+float16 uint64_to_float16_scalbn(uint64 a, int scale STATUS_PARAM)
+{
+    return uint64ToScaledFloat16(0, a, scale STATUS_VAR);
+}
+
+#define INT_TO_FLOAT16(type, via, cast)                              \
+    float16 type##_to_float16_scalbn(type a, int scale STATUS_PARAM) \
+    {                                                                \
+        return via##_to_float16_scalbn((cast)a, scale STATUS_VAR);   \
+    }                                                                \
+                                                                     \
+    float16 type##_to_float16(type a STATUS_PARAM)                   \
+    {                                                                \
+        return via##_to_float16_scalbn((cast)a, 0 STATUS_VAR);       \
+    }
+
+INT_TO_FLOAT16(int16, int64, int16_t)
+INT_TO_FLOAT16(uint16, uint64, uint16_t)
+INT_TO_FLOAT16(int32, int64, int32_t)
+INT_TO_FLOAT16(uint32, uint64, uint32_t)
+
+float16 int64_to_float16(int64 a STATUS_PARAM)
+{
+    return int64_to_float16_scalbn(a, 0 STATUS_VAR);
+}
+
+float16 uint64_to_float16(uint64 a STATUS_PARAM)
+{
+    return uint64_to_float16_scalbn(a, 0 STATUS_VAR);
 }
 
 /*----------------------------------------------------------------------------
@@ -6501,6 +6884,26 @@ float64 uint32_to_float64(uint32 a STATUS_PARAM)
     return int64_to_float64(a STATUS_VAR);
 }
 
+float32 int16_to_float32(int16 a STATUS_PARAM)
+{
+    return int32_to_float32((int16_t)a STATUS_VAR);
+}
+
+float64 int16_to_float64(int16 a STATUS_PARAM)
+{
+    return int32_to_float64((int16_t)a STATUS_VAR);
+}
+
+float32 uint16_to_float32(uint16 a STATUS_PARAM)
+{
+    return int32_to_float32((uint16_t)a STATUS_VAR);
+}
+
+float64 uint16_to_float64(uint16 a STATUS_PARAM)
+{
+    return int32_to_float64((uint16_t)a STATUS_VAR);
+}
+
 uint32 float32_to_uint32(float32 a STATUS_PARAM)
 {
     int64_t v;
@@ -6609,6 +7012,42 @@ uint32 float64_to_uint32_round_to_zero(float64 a STATUS_PARAM)
     return res;
 }
 
+int16 float64_to_int16(float64 a STATUS_PARAM)
+{
+    int64_t v;
+    int16 res;
+
+    v = float64_to_int64(a STATUS_VAR);
+    if(v < INT16_MIN) {
+        res = INT16_MIN;
+        float_raise(float_flag_invalid STATUS_VAR);
+    } else if(v > INT16_MAX) {
+        res = INT16_MAX;
+        float_raise(float_flag_invalid STATUS_VAR);
+    } else {
+        res = v;
+    }
+    return res;
+}
+
+uint16 float64_to_uint16(float64 a STATUS_PARAM)
+{
+    int64_t v;
+    uint16 res;
+
+    v = float64_to_int64(a STATUS_VAR);
+    if(v < 0) {
+        res = 0;
+        float_raise(float_flag_invalid STATUS_VAR);
+    } else if(v > UINT16_MAX) {
+        res = UINT16_MAX;
+        float_raise(float_flag_invalid STATUS_VAR);
+    } else {
+        res = v;
+    }
+    return res;
+}
+
 uint16 float64_to_uint16_round_to_zero(float64 a STATUS_PARAM)
 {
     int64_t v;
@@ -6753,9 +7192,27 @@ uint64_t float32_to_uint64(float32 a, float_status *status)
         return float##s##_compare_internal(a, b, 1 STATUS_VAR);                                                       \
     }
 
+COMPARE(16, 0x1f)
 COMPARE(32, 0xff)
 COMPARE(64, 0x7ff)
 
+int float16_eq_quiet(float16 a, float16 b STATUS_PARAM)
+{
+    return float16_compare_quiet(a, b STATUS_VAR) == float_relation_equal;
+}
+
+int float16_le(float16 a, float16 b STATUS_PARAM)
+{
+    int relation = float16_compare(a, b STATUS_VAR);
+
+    return relation == float_relation_less || relation == float_relation_equal;
+}
+
+int float16_lt(float16 a, float16 b STATUS_PARAM)
+{
+    return float16_compare(a, b STATUS_VAR) == float_relation_less;
+}
+
 INLINE int floatx80_compare_internal(floatx80 a, floatx80 b, int is_quiet STATUS_PARAM)
 {
     flag aSign, bSign;
@@ -6898,10 +7355,47 @@ int float128_compare_quiet(float128 a, float128 b STATUS_PARAM)
         }                                                                               \
     }
 
+MINMAX(16, 0x1f)
 MINMAX(32, 0xff)
 MINMAX(64, 0x7ff)
 
 /* Multiply A by 2 raised to the power N.  */
+float16 float16_scalbn(float16 a, int n STATUS_PARAM)
+{
+    flag aSign;
+    int16_t aExp;
+    uint32_t aSig;
+
+    a = float16_squash_input_denormal(a STATUS_VAR);
+    aSig = extractFloat16Frac(a);
+    aExp = extractFloat16Exp(a);
+    aSign = extractFloat16Sign(a);
+
+    if(aExp == 0x1F) {
+        if(aSig) {
+            return propagateFloat16NaN(a, a STATUS_VAR);
+        }
+        return a;
+    }
+    if(aExp != 0) {
+        aSig |= 0x400;
+    } else if(aSig == 0) {
+        return a;
+    } else {
+        aExp = 1;
+    }
+
+    if(n > 0x200) {
+        n = 0x200;
+    } else if(n < -0x200) {
+        n = -0x200;
+    }
+
+    aExp += n - 1;
+    aSig <<= 20;
+    return normalizeRoundAndPackFloat16(aSign, aExp, aSig, 1 STATUS_VAR);
+}
+
 float32 float32_scalbn(float32 a, int n STATUS_PARAM)
 {
     flag aSign;
@@ -215,6 +215,10 @@ float32 int32_to_float32(int32 STATUS_PARAM);
 float64 int32_to_float64(int32 STATUS_PARAM);
 float32 uint32_to_float32(uint32 STATUS_PARAM);
 float64 uint32_to_float64(uint32 STATUS_PARAM);
+float32 int16_to_float32(int16 STATUS_PARAM);
+float64 int16_to_float64(int16 STATUS_PARAM);
+float32 uint16_to_float32(uint16 STATUS_PARAM);
+float64 uint16_to_float64(uint16 STATUS_PARAM);
 floatx80 int32_to_floatx80(int32 STATUS_PARAM);
 float128 int32_to_float128(int32 STATUS_PARAM);
 float32 int64_to_float32(int64 STATUS_PARAM);
@@ -229,12 +233,111 @@ float128 int64_to_float128(int64 STATUS_PARAM);
  *----------------------------------------------------------------------------*/
 float16 float32_to_float16(float32, flag STATUS_PARAM);
 float32 float16_to_float32(float16, flag STATUS_PARAM);
+float64 float16_to_float64(float16, flag STATUS_PARAM);
+int16 float16_to_int16(float16 STATUS_PARAM);
+uint16 float16_to_uint16(float16 STATUS_PARAM);
+int16 float16_to_int16_round_to_zero(float16 STATUS_PARAM);
+uint16 float16_to_uint16_round_to_zero(float16 STATUS_PARAM);
+int32 float16_to_int32(float16 STATUS_PARAM);
+uint32 float16_to_uint32(float16 STATUS_PARAM);
+int32 float16_to_int32_round_to_zero(float16 STATUS_PARAM);
+uint32 float16_to_uint32_round_to_zero(float16 STATUS_PARAM);
+int64 float16_to_int64(float16 STATUS_PARAM);
+int64 float16_to_int64_round_to_zero(float16 STATUS_PARAM);
+uint64 float16_to_uint64(float16 STATUS_PARAM);
+uint64 float16_to_uint64_round_to_zero(float16 STATUS_PARAM);
+float16 int16_to_float16(int16 STATUS_PARAM);
+float16 uint16_to_float16(uint16 STATUS_PARAM);
+float16 int32_to_float16(int32 STATUS_PARAM);
+float16 uint32_to_float16(uint32 STATUS_PARAM);
+float16 int64_to_float16(int64 STATUS_PARAM);
+float16 uint64_to_float16(uint64 STATUS_PARAM);
+float16 int16_to_float16_scalbn(int16, int STATUS_PARAM);
+float16 uint16_to_float16_scalbn(uint16, int STATUS_PARAM);
+float16 int32_to_float16_scalbn(int32, int STATUS_PARAM);
+float16 uint32_to_float16_scalbn(uint32, int STATUS_PARAM);
+float16 int64_to_float16_scalbn(int64, int STATUS_PARAM);
+float16 uint64_to_float16_scalbn(uint64, int STATUS_PARAM);
 
 /*----------------------------------------------------------------------------
  | Software half-precision operations.
  *----------------------------------------------------------------------------*/
+float16 float16_squash_input_denormal(float16 a STATUS_PARAM);
+float16 float16_round_to_int(float16 STATUS_PARAM);
+float16 float16_add(float16, float16 STATUS_PARAM);
+float16 float16_sub(float16, float16 STATUS_PARAM);
+float16 float16_mul(float16, float16 STATUS_PARAM);
+float16 float16_div(float16, float16 STATUS_PARAM);
+float16 float16_muladd(float16, float16, float16, int STATUS_PARAM);
+float16 float16_sqrt(float16 STATUS_PARAM);
+int float16_eq_quiet(float16, float16 STATUS_PARAM);
+int float16_le(float16, float16 STATUS_PARAM);
+int float16_lt(float16, float16 STATUS_PARAM);
+int float16_compare(float16, float16 STATUS_PARAM);
+int float16_compare_quiet(float16, float16 STATUS_PARAM);
+float16 float16_min(float16, float16 STATUS_PARAM);
+float16 float16_max(float16, float16 STATUS_PARAM);
+float16 float16_minnum(float16, float16 STATUS_PARAM);
+float16 float16_maxnum(float16, float16 STATUS_PARAM);
+int float16_is_quiet_nan(float16 STATUS_PARAM);
 int float16_is_signaling_nan(float16 STATUS_PARAM);
 float16 float16_maybe_silence_nan(float16 STATUS_PARAM);
+float16 float16_scalbn(float16, int STATUS_PARAM);
+
+INLINE float16 float16_abs(float16 a)
+{
+    /* Note that abs does *not* handle NaN specially, nor does
+     * it flush denormal inputs to zero.
+     */
+    return make_float16(float16_val(a) & 0x7fff);
+}
+
+INLINE float16 float16_chs(float16 a)
+{
+    /* Note that chs does *not* handle NaN specially, nor does
+     * it flush denormal inputs to zero.
+     */
+    return make_float16(float16_val(a) ^ 0x8000);
+}
+
+INLINE int float16_is_infinity(float16 a)
+{
+    return (float16_val(a) & 0x7fff) == 0x7c00;
+}
+
+INLINE int float16_is_neg(float16 a)
+{
+    return float16_val(a) >> 15;
+}
+
+INLINE int float16_is_zero(float16 a)
+{
+    return (float16_val(a) & 0x7fff) == 0;
+}
+
+INLINE int float16_is_any_nan(float16 a)
+{
+    return ((float16_val(a) & ~0x8000) > 0x7c00);
+}
+
+INLINE int float16_is_zero_or_denormal(float16 a)
+{
+    return (float16_val(a) & 0x7c00) == 0;
+}
+
+INLINE float16 float16_set_sign(float16 a, int sign)
+{
+    return make_float16((float16_val(a) & 0x7fff) | (sign << 15));
+}
+
+#define float16_zero     make_float16(0)
+#define float16_one      make_float16(0x3c00)
+#define float16_half     make_float16(0x3800)
+#define float16_infinity make_float16(0x7c00)
+
+#define float16_two            make_float16(0x4000)
+#define float16_three          make_float16(0x4200)
+#define float16_one_point_five make_float16(0x3e00)
 
 /*----------------------------------------------------------------------------
  | The pattern for a default generated half-precision NaN.
@@ -360,6 +463,8 @@ extern const float32 float32_default_nan;
 /*----------------------------------------------------------------------------
  | Software IEC/IEEE double-precision conversion routines.
  *----------------------------------------------------------------------------*/
+int16 float64_to_int16(float64 STATUS_PARAM);
+uint16 float64_to_uint16(float64 STATUS_PARAM);
 int16 float64_to_int16_round_to_zero(float64 STATUS_PARAM);
 uint16 float64_to_uint16_round_to_zero(float64 STATUS_PARAM);
 int32 float64_to_int32(float64 STATUS_PARAM);
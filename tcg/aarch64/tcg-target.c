@@ -339,12 +339,28 @@ static inline void tcg_out_calli(TCGContext *s, tcg_target_ulong addr)
     tcg_out_blr(s, TCG_TMP_REG);
 }
 
-//  Emit a memory barrier, a0 contains info about the type of memory barrier requested
-static const int MB_SY = 0b1111;  //  Full system barrier
+//  Emit a memory barrier, barrier_type contains the TCG_MO_* orderings that have to be enforced
+//  Guest cores only share memory with each other, so an inner shareable barrier is enough
+static const int MB_ISH = 0b1011;    //  Inner shareable, orders all accesses
+static const int MB_ISHLD = 0b1001;  //  Inner shareable, orders loads against later loads and stores
+static const int MB_ISHST = 0b1010;  //  Inner shareable, orders stores against later stores
 static inline void tcg_out_mb(TCGContext *s, TCGArg barrier_type)
 {
-    //  Even if a weaker barrier might suffice, for now just always emit the strongest, full system barrier
-    tcg_out32(s, 0xd50330bf | (MB_SY << 8));
+    int option;
+    switch(barrier_type & TCG_MO_ALL) {
+        case TCG_MO_ST_ST:
+            option = MB_ISHST;
+            break;
+        case TCG_MO_LD_LD:
+        case TCG_MO_LD_ST:
+        case TCG_MO_LD_LD | TCG_MO_LD_ST:
+            option = MB_ISHLD;
+            break;
+        default:
+            option = MB_ISH;
+            break;
+    }
+    tcg_out32(s, 0xd50330bf | (option << 8));
 }
 
 //  Helper function to emit STP, store pair instructions with offset adressing mode (i.e no changing the base register)
@@ -963,6 +979,270 @@ static inline void tcg_out_setcond_imm(TCGContext *s, int bits, int reg_dest, in
     tcg_out_csinc(s, bits, reg_dest, TCG_REG_RZR, TCG_REG_RZR, tcg_invert_cond(cond));
 }
 
+//  Helper for the CSEL instruction (Conditional Select)
+//  Set reg_dest = reg_src_true if cond == true, reg_dest = reg_src_false otherwise
+static inline void tcg_out_csel(TCGContext *s, int bits, int reg_dest, int reg_src_true, int reg_src_false, tcg_target_long cond)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x1a800000 | (reg_src_false << 16) | (tcg_cond_to_arm_cond[cond] << 12) | (reg_src_true << 5) |
+                             (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0x9a800000 | (reg_src_false << 16) | (tcg_cond_to_arm_cond[cond] << 12) | (reg_src_true << 5) |
+                             (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("tcg_out_csel called with unsupported %i bits", bits);
+            break;
+    }
+}
+
+//  Helpers for the bitfield move instructions, all the extends, BFI, UBFX and immediate shifts are aliases of these.
+//  SBFM sign extends and UBFM zero extends the result, BFM leaves the bits outside of the field untouched.
+//  If immr <= imms bits [imms:immr] of reg_src are moved to the bottom of reg_dest,
+//  otherwise bits [imms:0] are moved to bit position (bits - immr)
+static inline void tcg_out_sbfm(TCGContext *s, int bits, int reg_dest, int reg_src, int immr, int imms)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x13000000 | (immr << 16) | (imms << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0x93400000 | (immr << 16) | (imms << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("sbfm for %i bits not implemented", bits);
+            break;
+    }
+}
+
+static inline void tcg_out_ubfm(TCGContext *s, int bits, int reg_dest, int reg_src, int immr, int imms)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x53000000 | (immr << 16) | (imms << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0xd3400000 | (immr << 16) | (imms << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("ubfm for %i bits not implemented", bits);
+            break;
+    }
+}
+
+static inline void tcg_out_bfm(TCGContext *s, int bits, int reg_dest, int reg_src, int immr, int imms)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x33000000 | (immr << 16) | (imms << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0xb3400000 | (immr << 16) | (imms << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("bfm for %i bits not implemented", bits);
+            break;
+    }
+}
+
+//  Inserts the low len bits of reg_src into reg_dest at bit position ofs (BFI)
+static inline void tcg_out_deposit(TCGContext *s, int bits, int reg_dest, int reg_src, int ofs, int len)
+{
+    tcg_out_bfm(s, bits, reg_dest, reg_src, -ofs & (bits - 1), len - 1);
+}
+
+//  Extracts len bits starting at bit position ofs of reg_src into the low bits of reg_dest (UBFX)
+static inline void tcg_out_extract(TCGContext *s, int bits, int reg_dest, int reg_src, int ofs, int len)
+{
+    tcg_out_ubfm(s, bits, reg_dest, reg_src, ofs, ofs + len - 1);
+}
+
+//  Helpers for the logical instructions with an inverted second operand: BIC, ORN and EON
+static inline void tcg_out_andc_reg(TCGContext *s, int bits, int reg_dest, int reg1, int reg2)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x0a200000 | (reg2 << 16) | (reg1 << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0x8a200000 | (reg2 << 16) | (reg1 << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("andc_reg called with unsupported bit width: %i", bits);
+    }
+}
+
+static inline void tcg_out_orc_reg(TCGContext *s, int bits, int reg_dest, int reg1, int reg2)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x2a200000 | (reg2 << 16) | (reg1 << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0xaa200000 | (reg2 << 16) | (reg1 << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("orc_reg called with unsupported bit width: %i", bits);
+    }
+}
+
+static inline void tcg_out_eqv_reg(TCGContext *s, int bits, int reg_dest, int reg1, int reg2)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x4a200000 | (reg2 << 16) | (reg1 << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0xca200000 | (reg2 << 16) | (reg1 << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("eqv_reg called with unsupported bit width: %i", bits);
+    }
+}
+
+static inline void tcg_out_not_reg(TCGContext *s, int bits, int reg_dest, int reg_src)
+{
+    //  MVN is an alias for ORN with the zero register as the first operand
+    tcg_out_orc_reg(s, bits, reg_dest, TCG_REG_RZR, reg_src);
+}
+
+static inline void tcg_out_neg_reg(TCGContext *s, int bits, int reg_dest, int reg_src)
+{
+    //  NEG is an alias for SUB with the zero register as the first operand
+    tcg_out_sub_reg(s, bits, reg_dest, TCG_REG_RZR, reg_src);
+}
+
+//  Emit RORV instruction
+static inline void tcg_out_rotr_reg(TCGContext *s, int bits, int reg_dest, int reg_src, int reg_shift)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x1ac02c00 | (reg_shift << 16) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0x9ac02c00 | (reg_shift << 16) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("rotr_reg for %i bits not implemented", bits);
+            break;
+    }
+}
+
+static inline void tcg_out_rotr_imm(TCGContext *s, int bits, int reg_dest, int reg_src, tcg_target_long shift)
+{
+    //  ROR (immediate) is an alias for EXTR with both source registers set to the same register
+    shift &= bits - 1;
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x13800000 | (reg_src << 16) | (shift << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0x93c00000 | (reg_src << 16) | (shift << 10) | (reg_src << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("rotr_imm for %i bits not implemented", bits);
+            break;
+    }
+}
+
+static inline void tcg_out_rotl_reg(TCGContext *s, int bits, int reg_dest, int reg_src, int reg_shift)
+{
+    //  There is no rotate left instruction, rotating right by the negated amount is equivalent
+    //  since RORV only uses the shift amount modulo the register width
+    tcg_out_neg_reg(s, 32, TCG_TMP_REG, reg_shift);
+    tcg_out_rotr_reg(s, bits, reg_dest, reg_src, TCG_TMP_REG);
+}
+
+static inline void tcg_out_rotl_imm(TCGContext *s, int bits, int reg_dest, int reg_src, tcg_target_long shift)
+{
+    tcg_out_rotr_imm(s, bits, reg_dest, reg_src, bits - shift);
+}
+
+//  Emit SDIV or UDIV instruction, dividing by zero gives zero instead of trapping
+static inline void tcg_out_div_reg(TCGContext *s, int bits, bool is_signed, int reg_dest, int reg_dividend, int reg_divisor)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x1ac00800 | (is_signed << 10) | (reg_divisor << 16) | (reg_dividend << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0x9ac00800 | (is_signed << 10) | (reg_divisor << 16) | (reg_dividend << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("div_reg for %i bits not implemented", bits);
+            break;
+    }
+}
+
+//  Helper for aarch64 MSUB instructions, computes reg_dest = reg_sub - (reg_prod1 * reg_prod2)
+static inline void tcg_out_mul_sub(TCGContext *s, int bits, int reg_dest, int reg_prod1, int reg_prod2, int reg_sub)
+{
+    switch(bits) {
+        case 32:
+            tcg_out32(s, 0x1b008000 | (reg_prod2 << 16) | (reg_sub << 10) | (reg_prod1 << 5) | (reg_dest << 0));
+            break;
+        case 64:
+            tcg_out32(s, 0x9b008000 | (reg_prod2 << 16) | (reg_sub << 10) | (reg_prod1 << 5) | (reg_dest << 0));
+            break;
+        default:
+            tcg_abortf("mul_sub for %i bits not implemented", bits);
+            break;
+    }
+}
+
+static inline void tcg_out_rem_reg(TCGContext *s, int bits, bool is_signed, int reg_dest, int reg_dividend, int reg_divisor)
+{
+    //  The remainder is calculated from the quotient as dividend - (quotient * divisor)
+    tcg_out_div_reg(s, bits, is_signed, TCG_TMP_REG, reg_dividend, reg_divisor);
+    tcg_out_mul_sub(s, bits, reg_dest, TCG_TMP_REG, reg_divisor, reg_dividend);
+}
+
+//  Computes the full double width product of reg1 and reg2 and stores it in the reg_dest_low, reg_dest_high pair
+static inline void tcg_out_mul2(TCGContext *s, int bits, bool is_signed, int reg_dest_low, int reg_dest_high, int reg1, int reg2)
+{
+    switch(bits) {
+        case 32:
+            //  SMULL/UMULL gives the whole 64-bit product in a single register, which is then split into halves
+            tcg_out32(s, 0x9b207c00 | (!is_signed << 23) | (reg2 << 16) | (reg1 << 5) | (TCG_TMP_REG << 0));
+            tcg_out_ubfm(s, 64, reg_dest_high, TCG_TMP_REG, 32, 63);
+            tcg_out_mov(s, TCG_TYPE_I32, reg_dest_low, TCG_TMP_REG);
+            break;
+        case 64:
+            //  The low half has to be kept in the temporary register until SMULH/UMULH has read the inputs,
+            //  as the output registers might be the same as the input ones
+            tcg_out_mul_reg(s, 64, TCG_TMP_REG, reg1, reg2);
+            tcg_out32(s, 0x9b407c00 | (!is_signed << 23) | (reg2 << 16) | (reg1 << 5) | (reg_dest_high << 0));
+            tcg_out_mov(s, TCG_TYPE_I64, reg_dest_low, TCG_TMP_REG);
+            break;
+        default:
+            tcg_abortf("mul2 for %i bits not implemented", bits);
+            break;
+    }
+}
+
+//  Byte swaps the low 16 bits of reg_src, flags describe the expected extension of the input and result
+static inline void tcg_out_bswap16(TCGContext *s, int bits, int reg_dest, int reg_src, int flags)
+{
+    //  REV16 swaps the bytes of both halfwords, the upper one is only guaranteed to be zero if the input was
+    tcg_out_bswap(s, 16, reg_dest, reg_src);
+    if(flags & TCG_BSWAP_OS) {
+        tcg_out_sbfm(s, bits, reg_dest, reg_dest, 0, 15);
+    } else if(!(flags & TCG_BSWAP_IZ)) {
+        tcg_out_ubfm(s, 32, reg_dest, reg_dest, 0, 15);
+    }
+}
+
+//  Byte swaps the low 32 bits of reg_src, the 32-bit REV clears the upper half of the 64-bit register
+static inline void tcg_out_bswap32(TCGContext *s, int bits, int reg_dest, int reg_src, int flags)
+{
+    tcg_out_bswap(s, 32, reg_dest, reg_src);
+    if(bits == 64 && (flags & TCG_BSWAP_OS)) {
+        tcg_out_sbfm(s, 64, reg_dest, reg_dest, 0, 31);
+    }
+}
+
 static inline bool has_host_atomics()
 {
 #if defined(__linux__)
@@ -1071,6 +1351,62 @@ static inline void tcg_out_atomic_compare_and_swap(TCGContext *s, int bits, int
     }
 }
 
+//  Emits a load exclusive pair (LDXP) of two 64-bit registers, optionally with aquire memory ordering (LDAXP)
+static inline void tcg_out_load_exclusive_pair(TCGContext *s, int reg_dest, int reg_dest2, int reg_addr, bool acquire)
+{
+    tcg_out32(s, 0xC87F0000 | (acquire << 15) | (reg_dest2 << 10) | (reg_addr << 5) | (reg_dest << 0));
+}
+
+//  Emits a store exclusive pair (STXP) of two 64-bit registers, optionally with release memory ordering (STLXP)
+static inline void tcg_out_store_exclusive_pair(TCGContext *s, int reg_result, int reg_val, int reg_val2, int reg_addr,
+                                                bool release)
+{
+    tcg_out32(s, 0xC8200000 | (reg_result << 16) | (release << 15) | (reg_val2 << 10) | (reg_addr << 5) | (reg_val << 0));
+}
+
+//  Emits a compare and swap pair (CASP) of two 64-bit registers, optionally with aquire and/or release memory ordering.
+//  Both `reg_expected` and `reg_val` name the first register of an even-numbered consecutive pair
+static inline void tcg_out_compare_and_swap_pair(TCGContext *s, int reg_expected, int reg_val, int reg_addr, bool acquire,
+                                                 bool release)
+{
+    tcg_out32(s, 0x48207C00 | (acquire << 22) | (reg_expected << 16) | (release << 15) | (reg_addr << 5) | (reg_val << 0));
+}
+
+//  Helper for the CCMP instruction (Conditional Compare)
+//  Compares reg1 with reg2 if cond == true, otherwise sets the flags to nzcv
+static inline void tcg_out_ccmp(TCGContext *s, int reg1, int reg2, int nzcv, int cond)
+{
+    tcg_out32(s, 0xFA400000 | (reg2 << 16) | (tcg_cond_to_arm_cond[cond] << 12) | (reg1 << 5) | (nzcv << 0));
+}
+
+//  Emits a 128-bit compare and swap with seq-const memory ordering.
+//  The expected value is passed in R0 (low) and R1 (high) and is replaced with the value read from memory,
+//  the new value is passed in R2 (low) and R3 (high). Registers holding the new value must be preserved by the caller
+//  as the Load/Store Exclusive fallback reads them on every iteration.
+static inline void tcg_out_atomic_compare_and_swap_128(TCGContext *s, int reg_addr, int reg_val_low, int reg_val_high,
+                                                       int reg_expected_low, int reg_expected_high)
+{
+    if(has_host_atomics()) {
+        tcg_out_mov(s, TCG_TYPE_I64, TCG_REG_R2, reg_val_low);
+        tcg_out_mov(s, TCG_TYPE_I64, TCG_REG_R3, reg_val_high);
+        tcg_out_compare_and_swap_pair(s, TCG_REG_R0, TCG_REG_R2, reg_addr, /* acquire: */ true, /* release: */ true);
+        return;
+    }
+
+    //  If the core does not have native compare and swap a fallback using a Load/Store Exclusive loop is needed.
+    //  A failed comparison writes back the value that was read, since only a successful STXP guarantees
+    //  that the 128-bit read was single-copy atomic.
+    uint8_t *start = s->code_ptr;
+    tcg_out_load_exclusive_pair(s, TCG_REG_R0, TCG_REG_R1, reg_addr, /* acquire: */ true);
+    tcg_out_cmp(s, 64, TCG_REG_R0, reg_expected_low);
+    tcg_out_ccmp(s, TCG_REG_R1, reg_expected_high, 0, TCG_COND_EQ);
+    tcg_out_csel(s, 64, TCG_REG_R2, reg_val_low, TCG_REG_R0, TCG_COND_EQ);
+    tcg_out_csel(s, 64, TCG_REG_R3, reg_val_high, TCG_REG_R1, TCG_COND_EQ);
+    tcg_out_store_exclusive_pair(s, TCG_TMP_REG, TCG_REG_R2, TCG_REG_R3, reg_addr, /* release: */ true);
+    //  Arm forward progress guarantee that we can't livelock here
+    tcg_out_compare_branch_non_zero(s, 32, TCG_TMP_REG, start - s->code_ptr);
+}
+
 static inline void tcg_out_emulated_atomic_fetch_and_add(TCGContext *s, int bits, int reg_dest, int reg_addr, int reg_val)
 {
     //  Move the address and value into a scratch register, in case reg_dest overlaps with any of them
@@ -1117,15 +1453,76 @@ static inline void tcg_out_atomic_fetch_and_add(TCGContext *s, int bits, int reg
     }
 }
 
+//  Patch a branch emitted with tcg_out_b_noaddr/tcg_out_b_cond_noaddr to jump to the current code pointer
+static inline void tcg_out_patch_branch_here(TCGContext *s, uint8_t *branch_ptr, int cond)
+{
+    if(cond == COND_AL) {
+        reloc_jump26(branch_ptr, (tcg_target_long)s->code_ptr);
+    } else {
+        reloc_condbr_19(branch_ptr, (tcg_target_long)s->code_ptr, cond);
+    }
+}
+
+//  Inline softmmu TLB lookup for the guest address already placed in R0
+//
+//  On a TLB hit R0 still holds the guest address and R1 holds the addend, so the host address is R0 + R1.
+//  On a miss the emitted conditional branch (returned through miss_ptr) is taken with R0 untouched,
+//  so the slow path can call the tcg ld/st functions directly.
+//  Clobbers R1, R2, and TCG_TMP_REG
+static inline void tcg_out_tlb_load(TCGContext *s, int mem_index, int s_bits, int which, uint8_t **miss_ptr)
+{
+    //  R1 = index of the TLB entry scaled by the entry size
+    tcg_out_lsr_imm(s, 64, TCG_REG_R1, TCG_REG_R0, TARGET_PAGE_BITS - CPU_TLB_ENTRY_BITS);
+    tcg_out_and_imm(s, 64, TCG_REG_R1, TCG_REG_R1, (CPU_TLB_SIZE - 1) << CPU_TLB_ENTRY_BITS);
+    tcg_out_add_reg(s, 64, TCG_REG_R1, TCG_AREG0, TCG_REG_R1);
+
+    //  R2 = env->tlb_table[mem_index][index].addr_read/addr_write
+    tcg_out_ld_offset(s, TARGET_LONG_BITS, false, TCG_REG_R2, TCG_REG_R1, tlb_table_n_0[mem_index] + which);
+
+    //  Keep the low address bits covered by the access size, so unaligned accesses take the slow path.
+    //  Flags stored in the low bits of the TLB entry (MMIO, invalid, one shot) make the compare fail as well
+    tcg_out_and_imm(s, TARGET_LONG_BITS, TCG_TMP_REG, TCG_REG_R0, TARGET_PAGE_MASK | ((1 << s_bits) - 1));
+    tcg_out_cmp(s, TARGET_LONG_BITS, TCG_REG_R2, TCG_TMP_REG);
+
+    //  b.ne to the slow path, patched by the caller
+    *miss_ptr = s->code_ptr;
+    tcg_out_b_cond_noaddr(s);
+
+    //  TLB hit, R1 = env->tlb_table[mem_index][index].addend
+    tcg_out_ld_offset(s, 64, false, TCG_REG_R1, TCG_REG_R1, tlb_table_n_0[mem_index] + tlb_entry_addend);
+}
+
 //  qemu_st/ld loads and stores to and from GUEST addresses, not host ones
 static inline void tcg_out_qemu_st(TCGContext *s, int bits, int reg_data, int reg_addr, int mem_index)
 {
     //  Store #bits number of bits from reg_data into the guest address in reg_addr
     //
     //  Clobbers R0, R1, and R2 since we need extra scratch registers
+    uint8_t *miss_ptr = NULL;
+    uint8_t *done_ptr = NULL;
+
+    //  Put the address in R0, zero extended to the guest address width
+    tcg_out_mov(s, TARGET_LONG_BITS == 64 ? TCG_TYPE_I64 : TCG_TYPE_I32, TCG_REG_R0, reg_addr);
+
+    if(likely(s->use_tlb)) {
+        tcg_out_tlb_load(s, mem_index, ctz32(bits / 8), tlb_entry_addr_write, &miss_ptr);
+
+        //  TLB hit, store directly to the host address R0 + R1
+#ifdef TARGET_WORDS_BIGENDIAN
+        if(bits != 8) {
+            tcg_out_bswap(s, bits, TCG_REG_R2, reg_data);
+            reg_data = TCG_REG_R2;
+        }
+#endif
+        tcg_out_st_reg_offset(s, bits, reg_data, TCG_REG_R0, TCG_REG_R1);
+        done_ptr = s->code_ptr;
+        tcg_out_b_noaddr(s);
 
-    //  Put the address in r0, data in R1, and mem_index in R2
-    tcg_out_mov(s, TCG_TYPE_I64, TCG_REG_R0, reg_addr);
+        //  TLB miss
+        tcg_out_patch_branch_here(s, miss_ptr, COND_NE);
+    }
+
+    //  Put the data in R1, and mem_index in R2
     tcg_out_sign_extend(s, bits, TCG_REG_R1, reg_data);
     tcg_out_movi(s, TCG_TYPE_I64, TCG_REG_R2, mem_index);
 
@@ -1146,16 +1543,41 @@ static inline void tcg_out_qemu_st(TCGContext *s, int bits, int reg_data, int re
         default:
             tcg_abortf("tcg_out_qemu_st called with incorrect #%i bits as argument", bits);
     }
-    //  Emit a memory barrier to make sure the store is observable on other cores before continueing
-    //  Needed to make sure atomic instructions using this works correctly
-    //  ST-LD barrier because we only need the store to be visible to future loads
-    tcg_out_mb(s, TCG_MO_ST_LD);
+
+    if(likely(s->use_tlb)) {
+        tcg_out_patch_branch_here(s, done_ptr, COND_AL);
+    }
 }
 
 static inline void tcg_out_qemu_ld(TCGContext *s, int bits, bool sign_extend, int reg_data, int reg_addr, int mem_index)
 {
-    //  Put the address in r0, and mem_index in r1
-    tcg_out_mov(s, TCG_TYPE_I64, TCG_REG_R0, reg_addr);
+    uint8_t *miss_ptr = NULL;
+    uint8_t *done_ptr = NULL;
+
+    //  Put the address in R0, zero extended to the guest address width
+    tcg_out_mov(s, TARGET_LONG_BITS == 64 ? TCG_TYPE_I64 : TCG_TYPE_I32, TCG_REG_R0, reg_addr);
+
+    if(likely(s->use_tlb)) {
+        tcg_out_tlb_load(s, mem_index, ctz32(bits / 8), tlb_entry_addr_read, &miss_ptr);
+
+        //  TLB hit, load directly from the host address R0 + R1
+        tcg_out_ld_reg_offset(s, bits, false, reg_data, TCG_REG_R0, TCG_REG_R1);
+#ifdef TARGET_WORDS_BIGENDIAN
+        if(bits != 8) {
+            tcg_out_bswap(s, bits, reg_data, reg_data);
+        }
+#endif
+        if(sign_extend) {
+            tcg_out_sign_extend(s, bits, reg_data, reg_data);
+        }
+        done_ptr = s->code_ptr;
+        tcg_out_b_noaddr(s);
+
+        //  TLB miss
+        tcg_out_patch_branch_here(s, miss_ptr, COND_NE);
+    }
+
+    //  Put mem_index in R1
     tcg_out_movi(s, TCG_TYPE_I64, TCG_REG_R1, mem_index);
 
     switch(bits) {
@@ -1181,6 +1603,10 @@ static inline void tcg_out_qemu_ld(TCGContext *s, int bits, bool sign_extend, in
     } else {
         tcg_out_mov(s, TCG_TYPE_I64, reg_data, TCG_REG_R0);
     }
+
+    if(likely(s->use_tlb)) {
+        tcg_out_patch_branch_here(s, done_ptr, COND_AL);
+    }
 }
 
 //  Variable used to store the return address. Used in INDEX_op_exit_tb
@@ -1213,6 +1639,10 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             }
             s->tb_next_offset[args[0]] = s->code_ptr - s->code_buf;
             break;
+        case INDEX_op_goto_ptr:
+            //  Indirect jump to the host code returned by the TB lookup helper
+            tcg_out_br(s, args[0]);
+            break;
         case INDEX_op_call:
             if(const_args[0]) {
                 //  Target function adress is an immediate
@@ -1350,7 +1780,22 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             }
             break;
         case INDEX_op_andc_i32:
-            tcg_abortf("op_andc_i32 not implemented");
+            tcg_out_andc_reg(s, 32, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_andc_i64:
+            tcg_out_andc_reg(s, 64, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_orc_i32:
+            tcg_out_orc_reg(s, 32, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_orc_i64:
+            tcg_out_orc_reg(s, 64, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_eqv_i32:
+            tcg_out_eqv_reg(s, 32, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_eqv_i64:
+            tcg_out_eqv_reg(s, 64, args[0], args[1], args[2]);
             break;
         case INDEX_op_or_i32:
             if(const_args[2]) {
@@ -1389,10 +1834,16 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             }
             break;
         case INDEX_op_neg_i32:
-            tcg_abortf("op_neg_i32 not implemented");
+            tcg_out_neg_reg(s, 32, args[0], args[1]);
+            break;
+        case INDEX_op_neg_i64:
+            tcg_out_neg_reg(s, 64, args[0], args[1]);
             break;
         case INDEX_op_not_i32:
-            tcg_abortf("op_not_i32 not implemented");
+            tcg_out_not_reg(s, 32, args[0], args[1]);
+            break;
+        case INDEX_op_not_i64:
+            tcg_out_not_reg(s, 64, args[0], args[1]);
             break;
         case INDEX_op_mul_i32:
             if(const_args[2]) {
@@ -1413,10 +1864,40 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             }
             break;
         case INDEX_op_mulu2_i32:
-            tcg_abortf("op_mulu2_i32 not implemented");
+            tcg_out_mul2(s, 32, false, args[0], args[1], args[2], args[3]);
+            break;
+        case INDEX_op_mulu2_i64:
+            tcg_out_mul2(s, 64, false, args[0], args[1], args[2], args[3]);
             break;
         case INDEX_op_muls2_i32:
-            tcg_abortf("op_muls2_i32 not implemented");
+            tcg_out_mul2(s, 32, true, args[0], args[1], args[2], args[3]);
+            break;
+        case INDEX_op_muls2_i64:
+            tcg_out_mul2(s, 64, true, args[0], args[1], args[2], args[3]);
+            break;
+        case INDEX_op_div_i32:
+            tcg_out_div_reg(s, 32, true, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_div_i64:
+            tcg_out_div_reg(s, 64, true, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_divu_i32:
+            tcg_out_div_reg(s, 32, false, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_divu_i64:
+            tcg_out_div_reg(s, 64, false, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_rem_i32:
+            tcg_out_rem_reg(s, 32, true, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_rem_i64:
+            tcg_out_rem_reg(s, 64, true, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_remu_i32:
+            tcg_out_rem_reg(s, 32, false, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_remu_i64:
+            tcg_out_rem_reg(s, 64, false, args[0], args[1], args[2]);
             break;
         case INDEX_op_shl_i32:
             if(const_args[2]) {
@@ -1461,10 +1942,32 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             }
             break;
         case INDEX_op_rotr_i32:
-            tcg_abortf("op_rotr_i32 not implemented");
+            if(const_args[2]) {
+                tcg_out_rotr_imm(s, 32, args[0], args[1], args[2]);
+            } else {
+                tcg_out_rotr_reg(s, 32, args[0], args[1], args[2]);
+            }
+            break;
+        case INDEX_op_rotr_i64:
+            if(const_args[2]) {
+                tcg_out_rotr_imm(s, 64, args[0], args[1], args[2]);
+            } else {
+                tcg_out_rotr_reg(s, 64, args[0], args[1], args[2]);
+            }
             break;
         case INDEX_op_rotl_i32:
-            tcg_abortf("op_rotl_i32 not implemented");
+            if(const_args[2]) {
+                tcg_out_rotl_imm(s, 32, args[0], args[1], args[2]);
+            } else {
+                tcg_out_rotl_reg(s, 32, args[0], args[1], args[2]);
+            }
+            break;
+        case INDEX_op_rotl_i64:
+            if(const_args[2]) {
+                tcg_out_rotl_imm(s, 64, args[0], args[1], args[2]);
+            } else {
+                tcg_out_rotl_reg(s, 64, args[0], args[1], args[2]);
+            }
             break;
         case INDEX_op_brcond_i32:
             if(const_args[1]) {
@@ -1510,6 +2013,22 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
         case INDEX_op_setcond2_i32:
             tcg_abortf("op_setcond2_i32 not implemented");
             break;
+        case INDEX_op_movcond_i32:
+            if(const_args[2]) {
+                tcg_out_cmpi(s, 32, args[1], args[2]);
+            } else {
+                tcg_out_cmp(s, 32, args[1], args[2]);
+            }
+            tcg_out_csel(s, 32, args[0], args[3], args[4], args[5]);
+            break;
+        case INDEX_op_movcond_i64:
+            if(const_args[2]) {
+                tcg_out_cmpi(s, 64, args[1], args[2]);
+            } else {
+                tcg_out_cmp(s, 64, args[1], args[2]);
+            }
+            tcg_out_csel(s, 64, args[0], args[3], args[4], args[5]);
+            break;
         case INDEX_op_qemu_ld8u:
             tcg_out_qemu_ld(s, 8, false, args[0], args[1], args[2]);
             break;
@@ -1547,19 +2066,57 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             tcg_out_qemu_st(s, 64, args[0], args[1], args[2]);
             break;
         case INDEX_op_bswap16_i32:
-            tcg_abortf("op_bswap16_i32 not implemented");
+            tcg_out_bswap16(s, 32, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_bswap16_i64:
+            tcg_out_bswap16(s, 64, args[0], args[1], args[2]);
             break;
         case INDEX_op_bswap32_i32:
-            tcg_abortf("op_bswap32_i32 not implemented");
+            tcg_out_bswap32(s, 32, args[0], args[1], args[2]);
+            break;
+        case INDEX_op_bswap32_i64:
+            tcg_out_bswap32(s, 64, args[0], args[1], args[2]);
             break;
+        case INDEX_op_bswap64_i64:
+            tcg_out_bswap(s, 64, args[0], args[1]);
+            break;
+        //  SXTB, SXTH and SXTW are aliases for SBFM
         case INDEX_op_ext8s_i32:
-            tcg_abortf("op_ext8s_i32 not implemented");
+            tcg_out_sbfm(s, 32, args[0], args[1], 0, 7);
+            break;
+        case INDEX_op_ext8s_i64:
+            tcg_out_sbfm(s, 64, args[0], args[1], 0, 7);
             break;
         case INDEX_op_ext16s_i32:
-            tcg_abortf("op_ext16s_i32 not implemented");
+            tcg_out_sbfm(s, 32, args[0], args[1], 0, 15);
+            break;
+        case INDEX_op_ext16s_i64:
+            tcg_out_sbfm(s, 64, args[0], args[1], 0, 15);
+            break;
+        case INDEX_op_ext32s_i64:
+            tcg_out_sbfm(s, 64, args[0], args[1], 0, 31);
+            break;
+        //  UXTB and UXTH are aliases for the 32-bit UBFM, which also clears the upper half of the 64-bit register
+        case INDEX_op_ext8u_i32:
+        case INDEX_op_ext8u_i64:
+            tcg_out_ubfm(s, 32, args[0], args[1], 0, 7);
             break;
         case INDEX_op_ext16u_i32:
-            tcg_abortf("op_ext16u_i32 not implemented");
+        case INDEX_op_ext16u_i64:
+            tcg_out_ubfm(s, 32, args[0], args[1], 0, 15);
+            break;
+        case INDEX_op_ext32u_i64:
+            tcg_out_mov(s, TCG_TYPE_I32, args[0], args[1]);
+            break;
+        case INDEX_op_deposit_i32:
+            //  The first input is aliased to the output, so only the inserted bits need to be written
+            tcg_out_deposit(s, 32, args[0], args[2], args[3], args[4]);
+            break;
+        case INDEX_op_deposit_i64:
+            tcg_out_deposit(s, 64, args[0], args[2], args[3], args[4]);
+            break;
+        case INDEX_op_extract_i32:
+            tcg_out_extract(s, 32, args[0], args[1], args[2], args[3]);
             break;
         case INDEX_op_add2_i32:
             //  The arm target assumes the arguments here are always registers, never constants.
@@ -1590,7 +2147,14 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             tcg_out_mov(s, TCG_TYPE_I64, args[0], TCG_TMP_REG);
             break;
         case INDEX_op_atomic_compare_and_swap_intrinsic_i128:
-            tcg_abortf("op_atomic_compare_and_swap_instrinsic_128 not implemented");
+            //  128-bit values are passed as (high, low) register pairs: actual, expected, host address and the new value.
+            //  CASP and the exclusive pair instructions work on fixed registers, so the expected value is moved into R0 and R1
+            //  and the result is read back from there, the 'c' constraint keeps the arguments out of R0-R3.
+            tcg_out_mov(s, TCG_TYPE_I64, TCG_REG_R0, args[3]);
+            tcg_out_mov(s, TCG_TYPE_I64, TCG_REG_R1, args[2]);
+            tcg_out_atomic_compare_and_swap_128(s, args[4], args[6], args[5], args[3], args[2]);
+            tcg_out_mov(s, TCG_TYPE_I64, args[1], TCG_REG_R0);
+            tcg_out_mov(s, TCG_TYPE_I64, args[0], TCG_REG_R1);
             break;
         case INDEX_op_atomic_fetch_add_intrinsic_i32:
             tcg_out_atomic_fetch_and_add(s, 32, args[0], args[1], args[2]);
@@ -1612,6 +2176,7 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
 static const TCGTargetOpDef arm_op_defs[] = {
     { INDEX_op_exit_tb, {} },
     { INDEX_op_goto_tb, {} },
+    { INDEX_op_goto_ptr, { "r" } },
     { INDEX_op_call, { "ri" } },
     { INDEX_op_jmp, { "ri" } },
     { INDEX_op_br, {} },
@@ -1654,6 +2219,18 @@ static const TCGTargetOpDef arm_op_defs[] = {
     { INDEX_op_sub_i64, { "r", "r", "r" } },
     { INDEX_op_mul_i32, { "r", "r", "r" } },
     { INDEX_op_mul_i64, { "r", "r", "r" } },
+    { INDEX_op_mulu2_i32, { "r", "r", "r", "r" } },
+    { INDEX_op_mulu2_i64, { "r", "r", "r", "r" } },
+    { INDEX_op_muls2_i32, { "r", "r", "r", "r" } },
+    { INDEX_op_muls2_i64, { "r", "r", "r", "r" } },
+    { INDEX_op_div_i32, { "r", "r", "r" } },
+    { INDEX_op_div_i64, { "r", "r", "r" } },
+    { INDEX_op_divu_i32, { "r", "r", "r" } },
+    { INDEX_op_divu_i64, { "r", "r", "r" } },
+    { INDEX_op_rem_i32, { "r", "r", "r" } },
+    { INDEX_op_rem_i64, { "r", "r", "r" } },
+    { INDEX_op_remu_i32, { "r", "r", "r" } },
+    { INDEX_op_remu_i64, { "r", "r", "r" } },
 
     { INDEX_op_and_i32, { "r", "r", "r" } },
     { INDEX_op_and_i64, { "r", "r", "r" } },
@@ -1661,6 +2238,12 @@ static const TCGTargetOpDef arm_op_defs[] = {
     { INDEX_op_or_i64, { "r", "r", "r" } },
     { INDEX_op_xor_i32, { "r", "r", "r" } },
     { INDEX_op_xor_i64, { "r", "r", "r" } },
+    { INDEX_op_andc_i32, { "r", "r", "r" } },
+    { INDEX_op_andc_i64, { "r", "r", "r" } },
+    { INDEX_op_orc_i32, { "r", "r", "r" } },
+    { INDEX_op_orc_i64, { "r", "r", "r" } },
+    { INDEX_op_eqv_i32, { "r", "r", "r" } },
+    { INDEX_op_eqv_i64, { "r", "r", "r" } },
 
     { INDEX_op_shl_i32, { "r", "r", "r" } },
     { INDEX_op_shl_i64, { "r", "r", "r" } },
@@ -1668,10 +2251,10 @@ static const TCGTargetOpDef arm_op_defs[] = {
     { INDEX_op_shr_i64, { "r", "r", "r" } },
     { INDEX_op_sar_i32, { "r", "r", "r" } },
     { INDEX_op_sar_i64, { "r", "r", "r" } },
-    { INDEX_op_rotl_i32, { "r", "r", "r" } },
-    { INDEX_op_rotl_i64, { "r", "r", "r" } },
-    { INDEX_op_rotr_i32, { "r", "r", "r" } },
-    { INDEX_op_rotr_i64, { "r", "r", "r" } },
+    { INDEX_op_rotl_i32, { "r", "r", "ri" } },
+    { INDEX_op_rotl_i64, { "r", "r", "ri" } },
+    { INDEX_op_rotr_i32, { "r", "r", "ri" } },
+    { INDEX_op_rotr_i64, { "r", "r", "ri" } },
 
     { INDEX_op_brcond_i32, { "r", "ri" } },
     { INDEX_op_brcond_i64, { "r", "r" } },
@@ -1702,11 +2285,11 @@ static const TCGTargetOpDef arm_op_defs[] = {
 
     { INDEX_op_setcond_i32, { "r", "r", "r" } },
     { INDEX_op_setcond_i64, { "r", "r", "r" } },
-    { INDEX_op_movcond_i32, { "r", "r", "r", "r", "r" } },
-    { INDEX_op_movcond_i64, { "r", "r", "r", "r", "r" } },
+    { INDEX_op_movcond_i32, { "r", "r", "ri", "r", "r" } },
+    { INDEX_op_movcond_i64, { "r", "r", "ri", "r", "r" } },
 
-    { INDEX_op_deposit_i32, { "r", "r", "r" } },
-    { INDEX_op_deposit_i64, { "r", "r", "r" } },
+    { INDEX_op_deposit_i32, { "r", "0", "r" } },
+    { INDEX_op_deposit_i64, { "r", "0", "r" } },
 
     { INDEX_op_extract_i32, { "r", "r" } },
 
@@ -1734,7 +2317,7 @@ static const TCGTargetOpDef arm_op_defs[] = {
 
     { INDEX_op_atomic_compare_and_swap_intrinsic_i32, { "c", "c", "c", "c" } },
     { INDEX_op_atomic_compare_and_swap_intrinsic_i64, { "c", "c", "c", "c" } },
-    { INDEX_op_atomic_compare_and_swap_intrinsic_i128, { "r", "r", "r", "r", "r", "r", "r" } },
+    { INDEX_op_atomic_compare_and_swap_intrinsic_i128, { "c", "c", "c", "c", "c", "c", "c" } },
 
     //  { -1 } indicates the end of the list
     { -1 },
@@ -1799,6 +2382,10 @@ static void tcg_target_qemu_prologue(TCGContext *s)
     tcg_out_mov(s, TCG_TYPE_PTR, TCG_AREG0, tcg_target_call_iarg_regs[0]);
     tcg_out_br(s, tcg_target_call_iarg_regs[1]);
 
+    //  Return path for goto_ptr lookup misses, falls through to the epilogue
+    s->code_gen_epilogue = rw_ptr_to_rx(s->code_ptr);
+    tcg_out_movi(s, TCG_TYPE_PTR, TCG_REG_R0, 0);
+
     //  Epilogue
     tb_ret_addr = rw_ptr_to_rx(s->code_ptr);
     //  Load all the registers we saved above to restore system state
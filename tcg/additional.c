@@ -25,6 +25,10 @@
 #include <string.h>
 #include "tcg.h"
 
+/* Each emulated core loads its own copy of the library, so this context, the code buffer and the
+ * TB tables in exec.c belong to a single core and are never shared between host threads. Cores
+ * translate in parallel; only the atomic memory state and dirty address broadcasts cross instances.
+ */
 tcg_t *tcg;
 
 void *(*_TCG_malloc)(size_t);
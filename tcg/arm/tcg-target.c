@@ -250,6 +250,7 @@ enum arm_data_opc_e {
 
 typedef enum {
     INSN_DMB_ISH = 0xf57ff05b,
+    INSN_DMB_ISHST = 0xf57ff05a,
     INSN_DMB_MCR = 0xee070fba,
 } ARMInsn;
 
@@ -788,7 +789,8 @@ static inline void tcg_out_goto_label(TCGContext *s, int cond, int label_index)
 static inline void tcg_out_mb(TCGContext *s, TCGArg a0)
 {
     if(use_armv7_instructions) {
-        tcg_out32(s, INSN_DMB_ISH);
+        /* ARMv7 only has a store-only variant, everything else needs the full barrier */
+        tcg_out32(s, (a0 & TCG_MO_ALL) == TCG_MO_ST_ST ? INSN_DMB_ISHST : INSN_DMB_ISH);
     } else if(use_armv6_instructions) {
         tcg_out32(s, INSN_DMB_MCR);
     } else {
@@ -1181,6 +1183,9 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             }
             s->tb_next_offset[args[0]] = s->code_ptr - s->code_buf;
             break;
+        case INDEX_op_goto_ptr:
+            tcg_out_bx(s, COND_AL, args[0]);
+            break;
         case INDEX_op_call:
             if(const_args[0]) {
                 tcg_out_call(s, args[0]);
@@ -1408,6 +1413,7 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
 static const TCGTargetOpDef arm_op_defs[] = {
     { INDEX_op_exit_tb, {} },
     { INDEX_op_goto_tb, {} },
+    { INDEX_op_goto_ptr, { "r" } },
     { INDEX_op_call, { "ri" } },
     { INDEX_op_jmp, { "ri" } },
     { INDEX_op_br, {} },
@@ -1542,6 +1548,11 @@ static void tcg_target_qemu_prologue(TCGContext *s)
     tcg_out_mov(s, TCG_TYPE_PTR, TCG_AREG0, tcg_target_call_iarg_regs[0]);
 
     tcg_out_bx(s, COND_AL, tcg_target_call_iarg_regs[1]);
+
+    /* Return path for goto_ptr lookup misses, falls through to the TB epilogue */
+    s->code_gen_epilogue = rw_ptr_to_rx(s->code_ptr);
+    tcg_out_dat_imm(s, COND_AL, ARITH_MOV, TCG_REG_R0, 0, 0);
+
     tb_ret_addr = s->code_ptr;
 
     /* ldmia sp!, { r4 - r12, pc } */
@@ -1440,6 +1440,10 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
             }
             s->tb_next_offset[args[0]] = s->code_ptr - s->code_buf;
             break;
+        case INDEX_op_goto_ptr:
+            /* jmp *reg */
+            tcg_out_modrm(s, OPC_GRP5, EXT5_JMPN_Ev, args[0]);
+            break;
         case INDEX_op_call:
             if(const_args[0]) {
                 tcg_out_calli(s, args[0]);
@@ -1870,6 +1874,7 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc, const TCGArg *args,
 static const TCGTargetOpDef x86_op_defs[] = {
     { INDEX_op_exit_tb, {} },
     { INDEX_op_goto_tb, {} },
+    { INDEX_op_goto_ptr, { "r" } },
     { INDEX_op_call, { "ri" } },
     { INDEX_op_jmp, { "ri" } },
     { INDEX_op_br, {} },
@@ -2072,6 +2077,10 @@ static void tcg_target_qemu_prologue(TCGContext *s)
     /* jmp *tb.  */
     tcg_out_modrm(s, OPC_GRP5, EXT5_JMPN_Ev, tcg_target_call_iarg_regs[1]);
 
+    /* Return path for goto_ptr lookup misses, falls through to the TB epilogue */
+    s->code_gen_epilogue = rw_ptr_to_rx(s->code_ptr);
+    tcg_out_movi(s, TCG_TYPE_PTR, TCG_REG_EAX, 0);
+
     /* TB epilogue */
     tb_ret_addr = s->code_ptr;
 
@@ -44,10 +44,26 @@ struct tcg_temp_info {
     uint16_t prev_copy;
     uint16_t next_copy;
     tcg_target_ulong val;
+    tcg_target_ulong known_zero;
+    tcg_target_ulong known_one;
 };
 
 static struct tcg_temp_info temps[TCG_MAX_TEMPS];
 
+/* Loads from memory whose result is still held in a temp.  Only valid
+   within one basic block. */
+#define TCG_OPT_MAX_LDS 32
+
+struct tcg_ld_info {
+    TCGOpcode op;
+    TCGArg base;
+    tcg_target_long offset;
+    TCGArg val;
+};
+
+static struct tcg_ld_info lds[TCG_OPT_MAX_LDS];
+static int nb_lds;
+
 /* Reset TEMP's state to TCG_TEMP_ANY.  If TEMP was a representative of some
    class of equivalent temp's, a new representative should be chosen in this
    class. */
@@ -78,6 +94,8 @@ static void reset_temp(TCGArg temp, int nb_temps, int nb_globals)
         new_base = temps[temp].val;
     }
     temps[temp].state = TCG_TEMP_ANY;
+    temps[temp].known_zero = 0;
+    temps[temp].known_one = 0;
     if(new_base != (TCGArg)-1 && temps[new_base].next_copy == new_base) {
         temps[new_base].state = TCG_TEMP_ANY;
     }
@@ -103,9 +121,32 @@ static TCGOpcode op_to_movi(TCGOpcode op)
     }
 }
 
+/* Bits of TEMP which are known to be zero.  For 32-bit temps only the low
+   32 bits are meaningful. */
+static tcg_target_ulong temp_known_zero(TCGArg temp)
+{
+    if(temps[temp].state == TCG_TEMP_CONST) {
+        return ~temps[temp].val;
+    }
+    return temps[temp].known_zero;
+}
+
+/* Bits of TEMP which are known to be one, with the same caveat. */
+static tcg_target_ulong temp_known_one(TCGArg temp)
+{
+    if(temps[temp].state == TCG_TEMP_CONST) {
+        return temps[temp].val;
+    }
+    return temps[temp].known_one;
+}
+
 static void tcg_opt_gen_mov(TCGContext *s, TCGArg *gen_args, TCGArg dst, TCGArg src, int nb_temps, int nb_globals)
 {
+    tcg_target_ulong known_zero = temp_known_zero(src);
+    tcg_target_ulong known_one = temp_known_one(src);
     reset_temp(dst, nb_temps, nb_globals);
+    temps[dst].known_zero = known_zero;
+    temps[dst].known_one = known_one;
     assert(temps[src].state != TCG_TEMP_COPY);
     /* Don't try to copy if one of temps is a global or either one
        is local and another is register */
@@ -259,14 +300,429 @@ static TCGArg do_constant_folding(TCGOpcode op, TCGArg x, TCGArg y)
     return res;
 }
 
-/* Propagate constants and copies, fold constant expressions. */
+static bool do_constant_folding_cond_32(uint32_t x, uint32_t y, TCGCond c)
+{
+    switch(c) {
+        case TCG_COND_EQ:
+            return x == y;
+        case TCG_COND_NE:
+            return x != y;
+        case TCG_COND_LT:
+            return (int32_t)x < (int32_t)y;
+        case TCG_COND_GE:
+            return (int32_t)x >= (int32_t)y;
+        case TCG_COND_LE:
+            return (int32_t)x <= (int32_t)y;
+        case TCG_COND_GT:
+            return (int32_t)x > (int32_t)y;
+        case TCG_COND_LTU:
+            return x < y;
+        case TCG_COND_GEU:
+            return x >= y;
+        case TCG_COND_LEU:
+            return x <= y;
+        case TCG_COND_GTU:
+            return x > y;
+        default:
+            tcg_abortf("Unrecognized condition %d in do_constant_folding_cond.\n", c);
+            tlib_assert_not_reached();
+    }
+}
+
+static bool do_constant_folding_cond_64(uint64_t x, uint64_t y, TCGCond c)
+{
+    switch(c) {
+        case TCG_COND_EQ:
+            return x == y;
+        case TCG_COND_NE:
+            return x != y;
+        case TCG_COND_LT:
+            return (int64_t)x < (int64_t)y;
+        case TCG_COND_GE:
+            return (int64_t)x >= (int64_t)y;
+        case TCG_COND_LE:
+            return (int64_t)x <= (int64_t)y;
+        case TCG_COND_GT:
+            return (int64_t)x > (int64_t)y;
+        case TCG_COND_LTU:
+            return x < y;
+        case TCG_COND_GEU:
+            return x >= y;
+        case TCG_COND_LEU:
+            return x <= y;
+        case TCG_COND_GTU:
+            return x > y;
+        default:
+            tcg_abortf("Unrecognized condition %d in do_constant_folding_cond.\n", c);
+            tlib_assert_not_reached();
+    }
+}
+
+/* Return 1 if the condition is known to hold, 0 if it is known not to hold
+   and 2 if it cannot be decided at translation time. */
+static int do_constant_folding_cond(TCGOpcode op, TCGArg x, TCGArg y, TCGCond c)
+{
+    if(c == TCG_COND_ALWAYS) {
+        return 1;
+    }
+    if(c == TCG_COND_NEVER) {
+        return 0;
+    }
+    if(temps[x].state == TCG_TEMP_COPY) {
+        x = temps[x].val;
+    }
+    if(temps[y].state == TCG_TEMP_COPY) {
+        y = temps[y].val;
+    }
+    if(temps[x].state == TCG_TEMP_CONST && temps[y].state == TCG_TEMP_CONST) {
+        if(op_bits(op) == 32) {
+            return do_constant_folding_cond_32(temps[x].val, temps[y].val, c);
+        }
+        return do_constant_folding_cond_64(temps[x].val, temps[y].val, c);
+    }
+    if(x == y) {
+        switch(c) {
+            case TCG_COND_EQ:
+            case TCG_COND_GE:
+            case TCG_COND_LE:
+            case TCG_COND_GEU:
+            case TCG_COND_LEU:
+                return 1;
+            default:
+                return 0;
+        }
+    }
+    if(temps[y].state == TCG_TEMP_CONST && (op_bits(op) == 32 ? (uint32_t)temps[y].val : temps[y].val) == 0) {
+        /* Nothing is unsigned-below zero. */
+        if(c == TCG_COND_LTU) {
+            return 0;
+        }
+        if(c == TCG_COND_GEU) {
+            return 1;
+        }
+    }
+    return 2;
+}
+
+/* Compute which bits of the result of OP are known to be zero, given what
+   is known about its inputs.  Returns 0 when nothing is known. */
+static tcg_target_ulong known_zero_bits_2(TCGOpcode op, const TCGArg *args)
+{
+    TCGArg shift;
+    int bits = op_bits(op);
+
+    switch(op) {
+        CASE_OP_32_64(ld8u)
+            : return ~(tcg_target_ulong)0xff;
+        CASE_OP_32_64(ld16u)
+            : return ~(tcg_target_ulong)0xffff;
+        case INDEX_op_ld32u_i64:
+            return ~(tcg_target_ulong)0xffffffff;
+        CASE_OP_32_64(ext8u)
+            : return temp_known_zero(args[1]) | ~(tcg_target_ulong)0xff;
+        CASE_OP_32_64(ext16u)
+            : return temp_known_zero(args[1]) | ~(tcg_target_ulong)0xffff;
+        case INDEX_op_ext32u_i64:
+            return temp_known_zero(args[1]) | ~(tcg_target_ulong)0xffffffff;
+        CASE_OP_32_64(setcond)
+            : return ~(tcg_target_ulong)1;
+        CASE_OP_32_64(not)
+            : return temp_known_one(args[1]);
+        CASE_OP_32_64(and)
+            : return temp_known_zero(args[1]) | temp_known_zero(args[2]);
+        CASE_OP_32_64(andc)
+            : return temp_known_zero(args[1]) | temp_known_one(args[2]);
+        CASE_OP_32_64(orc)
+            : return temp_known_zero(args[1]) & temp_known_one(args[2]);
+        CASE_OP_32_64(or)
+            : return temp_known_zero(args[1]) & temp_known_zero(args[2]);
+        CASE_OP_32_64(xor)
+            : return (temp_known_zero(args[1]) & temp_known_zero(args[2])) | (temp_known_one(args[1]) & temp_known_one(args[2]));
+        CASE_OP_32_64(movcond)
+            : return temp_known_zero(args[3]) & temp_known_zero(args[4]);
+        CASE_OP_32_64(shr)
+            : if(temps[args[2]].state != TCG_TEMP_CONST || temps[args[2]].val >= bits)
+        {
+            return 0;
+        }
+        shift = temps[args[2]].val;
+        if(bits == 32) {
+            return ((uint32_t)temp_known_zero(args[1]) >> shift) | ~((tcg_target_ulong)0xffffffff >> shift);
+        }
+        return (temp_known_zero(args[1]) >> shift) | ~(~(tcg_target_ulong)0 >> shift);
+        CASE_OP_32_64(shl)
+            : if(temps[args[2]].state != TCG_TEMP_CONST || temps[args[2]].val >= bits)
+        {
+            return 0;
+        }
+        shift = temps[args[2]].val;
+        return (temp_known_zero(args[1]) << shift) | (((tcg_target_ulong)1 << shift) - 1);
+        case INDEX_op_extract_i32:
+            if(args[3] >= 32) {
+                return 0;
+            }
+            return ~(((tcg_target_ulong)1 << args[3]) - 1);
+        default:
+            return 0;
+    }
+}
+
+static tcg_target_ulong known_zero_bits(TCGOpcode op, const TCGArg *args)
+{
+    tcg_target_ulong res = known_zero_bits_2(op, args);
+    if(op_bits(op) == 32) {
+        /* Claim nothing about the undefined upper half. */
+        res &= 0xffffffff;
+    }
+    return res;
+}
+
+/* Compute which bits of the result of OP are known to be one.  Returns 0
+   when nothing is known. */
+static tcg_target_ulong known_one_bits_2(TCGOpcode op, const TCGArg *args)
+{
+    TCGArg shift;
+    int bits = op_bits(op);
+
+    switch(op) {
+        CASE_OP_32_64(ext8u)
+            : return temp_known_one(args[1]) & 0xff;
+        CASE_OP_32_64(ext16u)
+            : return temp_known_one(args[1]) & 0xffff;
+        case INDEX_op_ext32u_i64:
+            return temp_known_one(args[1]) & 0xffffffff;
+        CASE_OP_32_64(not)
+            : return temp_known_zero(args[1]);
+        CASE_OP_32_64(and)
+            : return temp_known_one(args[1]) & temp_known_one(args[2]);
+        CASE_OP_32_64(andc)
+            : return temp_known_one(args[1]) & temp_known_zero(args[2]);
+        CASE_OP_32_64(or)
+            : return temp_known_one(args[1]) | temp_known_one(args[2]);
+        CASE_OP_32_64(orc)
+            : return temp_known_one(args[1]) | temp_known_zero(args[2]);
+        CASE_OP_32_64(xor)
+            : return (temp_known_one(args[1]) & temp_known_zero(args[2])) | (temp_known_zero(args[1]) & temp_known_one(args[2]));
+        CASE_OP_32_64(movcond)
+            : return temp_known_one(args[3]) & temp_known_one(args[4]);
+        CASE_OP_32_64(shr)
+            : if(temps[args[2]].state != TCG_TEMP_CONST || temps[args[2]].val >= bits)
+        {
+            return 0;
+        }
+        shift = temps[args[2]].val;
+        if(bits == 32) {
+            return (uint32_t)temp_known_one(args[1]) >> shift;
+        }
+        return temp_known_one(args[1]) >> shift;
+        CASE_OP_32_64(shl)
+            : if(temps[args[2]].state != TCG_TEMP_CONST || temps[args[2]].val >= bits)
+        {
+            return 0;
+        }
+        shift = temps[args[2]].val;
+        return temp_known_one(args[1]) << shift;
+        default:
+            return 0;
+    }
+}
+
+static tcg_target_ulong known_one_bits(TCGOpcode op, const TCGArg *args)
+{
+    tcg_target_ulong res = known_one_bits_2(op, args);
+    if(op_bits(op) == 32) {
+        res &= 0xffffffff;
+    }
+    return res;
+}
+
+/* Return true if every bit of the result of OP is known, so that it can be
+   replaced with a movi of KNOWN_ONE. */
+static bool result_is_known(TCGOpcode op, tcg_target_ulong known_zero, tcg_target_ulong known_one)
+{
+    tcg_target_ulong width = op_bits(op) == 32 ? 0xffffffff : ~(tcg_target_ulong)0;
+
+    return ((known_zero | known_one) & width) == width;
+}
+
+/* Return true if the masking operation OP cannot clear any bit which may be
+   set in its input, nor set any bit which may be clear in it, i.e. the result
+   always equals args[1]. */
+static bool mask_is_redundant(TCGContext *s, TCGOpcode op, const TCGArg *args)
+{
+    tcg_target_ulong keep;
+    tcg_target_ulong width = op_bits(op) == 32 ? 0xffffffff : ~(tcg_target_ulong)0;
+
+    if(temps[args[1]].state == TCG_TEMP_CONST) {
+        /* Leave it to constant folding. */
+        return false;
+    }
+    switch(op) {
+        CASE_OP_32_64(ext8u)
+            : keep = 0xff;
+        break;
+        CASE_OP_32_64(ext16u)
+            : keep = 0xffff;
+        break;
+        case INDEX_op_ext32u_i64:
+            /* The upper half of a 32-bit temp is not defined. */
+            if(s->temps[args[1]].type != TCG_TYPE_I64) {
+                return false;
+            }
+            keep = 0xffffffff;
+            break;
+        CASE_OP_32_64(and)
+            : if(temps[args[2]].state != TCG_TEMP_CONST)
+        {
+            return false;
+        }
+        keep = temps[args[2]].val;
+        break;
+        CASE_OP_32_64(or)
+            : if(temps[args[2]].state != TCG_TEMP_CONST)
+        {
+            return false;
+        }
+        return (~temp_known_one(args[1]) & temps[args[2]].val & width) == 0;
+        default:
+            return false;
+    }
+    return (~temp_known_zero(args[1]) & ~keep & width) == 0;
+}
+
+static int mem_access_size(TCGOpcode op)
+{
+    switch(op) {
+        CASE_OP_32_64(ld8u)
+            : CASE_OP_32_64(ld8s)
+            : CASE_OP_32_64(st8)
+            : return 1;
+        CASE_OP_32_64(ld16u)
+            : CASE_OP_32_64(ld16s)
+            : CASE_OP_32_64(st16)
+            : return 2;
+        case INDEX_op_ld_i32:
+        case INDEX_op_ld32u_i64:
+        case INDEX_op_ld32s_i64:
+        case INDEX_op_st_i32:
+        case INDEX_op_st32_i64:
+            return 4;
+        case INDEX_op_ld_i64:
+        case INDEX_op_st_i64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+static int lds_find(TCGOpcode op, TCGArg base, tcg_target_long offset)
+{
+    int i;
+    for(i = 0; i < nb_lds; i++) {
+        if(lds[i].op == op && lds[i].base == base && lds[i].offset == offset) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void lds_remove(int i)
+{
+    lds[i] = lds[--nb_lds];
+}
+
+static void lds_record(TCGOpcode op, TCGArg base, tcg_target_long offset, TCGArg val)
+{
+    if(nb_lds == TCG_OPT_MAX_LDS) {
+        memmove(&lds[0], &lds[1], (TCG_OPT_MAX_LDS - 1) * sizeof(struct tcg_ld_info));
+        nb_lds--;
+    }
+    lds[nb_lds].op = op;
+    lds[nb_lds].base = base;
+    lds[nb_lds].offset = offset;
+    lds[nb_lds].val = val;
+    nb_lds++;
+}
+
+/* TEMP is about to be overwritten: forget loads which used it as the
+   base pointer or hold their value in it. */
+static void lds_forget_temp(TCGArg temp)
+{
+    int i;
+    for(i = 0; i < nb_lds; i++) {
+        if(lds[i].base == temp || lds[i].val == temp) {
+            lds_remove(i--);
+        }
+    }
+}
+
+/* Forget loads which might read memory written by OP. */
+static void lds_forget_op(TCGOpcode op, const TCGOpDef *def, const TCGArg *args)
+{
+    int i, size;
+    tcg_target_long offset;
+
+    size = mem_access_size(op);
+    if(size != 0 && def->nb_oargs != 0) {
+        /* Loads update the table themselves. */
+        return;
+    }
+    if(size != 0) {
+        /* A store through a different base may alias anything. */
+        offset = args[2];
+        for(i = 0; i < nb_lds; i++) {
+            if(lds[i].base != args[1] ||
+               (lds[i].offset < offset + size && offset < lds[i].offset + mem_access_size(lds[i].op))) {
+                lds_remove(i--);
+            }
+        }
+        return;
+    }
+    if(op == INDEX_op_call || op == INDEX_op_set_label || op == INDEX_op_mb || op == INDEX_op_st_vec ||
+       (def->flags & (TCG_OPF_BB_END | TCG_OPF_CALL_CLOBBER | TCG_OPF_SIDE_EFFECTS))) {
+        nb_lds = 0;
+        return;
+    }
+    for(i = 0; i < def->nb_oargs; i++) {
+        lds_forget_temp(args[i]);
+    }
+}
+
+/* Barriers can only be merged across ops that neither access memory
+   nor end the basic block. */
+static bool op_keeps_prev_mb(TCGOpcode op, const TCGOpDef *def)
+{
+    if(def->flags & (TCG_OPF_BB_END | TCG_OPF_CALL_CLOBBER | TCG_OPF_SIDE_EFFECTS)) {
+        return false;
+    }
+    switch(op) {
+        case INDEX_op_set_label:
+            CASE_OP_32_64(ld8u)
+                : CASE_OP_32_64(ld8s)
+                : CASE_OP_32_64(ld16u)
+                : CASE_OP_32_64(ld16s)
+                : case INDEX_op_ld_i32:
+        case INDEX_op_ld32u_i64:
+        case INDEX_op_ld32s_i64:
+        case INDEX_op_ld_i64:
+        case INDEX_op_ld_vec:
+            return false;
+        default:
+            return true;
+    }
+}
+
+/* Propagate constants and copies, fold constant expressions and conditions,
+   drop redundant masks and reuse the results of repeated loads. */
 static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr, TCGArg *args, TCGOpDef *tcg_op_defs)
 {
     int i, nb_ops, op_index, nb_temps, nb_globals, nb_call_args;
     TCGOpcode op;
     const TCGOpDef *def;
     TCGArg *gen_args;
+    TCGArg *prev_mb = NULL;
     TCGArg tmp;
+    tcg_target_ulong known_zero, known_one;
     /* Array VALS has an element for each temp.
        If this temp holds a constant then its value is kept in VALS' element.
        If this temp is a copy of other ones then this equivalence class'
@@ -277,12 +733,16 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
     nb_temps = s->nb_temps;
     nb_globals = s->nb_globals;
     memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
+    nb_lds = 0;
 
     nb_ops = tcg_opc_ptr - tcg->gen_opc_buf;
     gen_args = args;
     for(op_index = 0; op_index < nb_ops; op_index++) {
         op = tcg->gen_opc_buf[op_index].opcode;
         def = &tcg_op_defs[op];
+        if(op != INDEX_op_mb && !op_keeps_prev_mb(op, def)) {
+            prev_mb = NULL;
+        }
         /* Do copy propagation */
         if(!(def->flags & (TCG_OPF_CALL_CLOBBER | TCG_OPF_SIDE_EFFECTS))) {
             assert(op != INDEX_op_call);
@@ -292,6 +752,7 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
                 }
             }
         }
+        lds_forget_op(op, def, args);
 
         /* For commutative operations make constant second argument */
         switch(op) {
@@ -316,6 +777,21 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
 
         /* Simplify expression if possible. */
         switch(op) {
+            CASE_OP_32_64(ext8u)
+                : CASE_OP_32_64(ext16u)
+                : case INDEX_op_ext32u_i64:
+            if(mask_is_redundant(s, op, args)) {
+                if(args[0] == args[1]) {
+                    tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(INDEX_op_nop);
+                } else {
+                    tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(op_to_mov(op));
+                    tcg_opt_gen_mov(s, gen_args, args[0], args[1], nb_temps, nb_globals);
+                    gen_args += 2;
+                }
+                args += 2;
+                continue;
+            }
+            break;
             CASE_OP_32_64(add)
                 : CASE_OP_32_64(sub)
                 : CASE_OP_32_64(shl)
@@ -353,7 +829,7 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
             break;
             CASE_OP_32_64(or)
                 : CASE_OP_32_64(and)
-                : if(args[1] == args[2])
+                : if(args[1] == args[2] || mask_is_redundant(s, op, args))
             {
                 if(args[1] == args[0]) {
                     args += 3;
@@ -371,6 +847,9 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
                 break;
         }
 
+        known_zero = known_zero_bits(op, args);
+        known_one = known_one_bits(op, args);
+
         /* Propagate constants through copy operations and do constant
            folding.  Constants will be substituted to arguments by register
            allocator where needed and possible.  Also detect copies. */
@@ -414,8 +893,16 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
                 gen_args += 2;
                 args += 2;
                 break;
+            } else if(result_is_known(op, known_zero, known_one)) {
+                tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(op_to_movi(op));
+                tcg_opt_gen_movi(gen_args, args[0], known_one, nb_temps, nb_globals);
+                gen_args += 2;
+                args += 2;
+                break;
             } else {
                 reset_temp(args[0], nb_temps, nb_globals);
+                temps[args[0]].known_zero = known_zero;
+                temps[args[0]].known_one = known_one;
                 gen_args[0] = args[0];
                 gen_args[1] = args[1];
                 gen_args += 2;
@@ -447,9 +934,20 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
                 args += 3;
                 break;
             }
+            else if(result_is_known(op, known_zero, known_one))
+            {
+                /* e.g. an or setting, or an and clearing, every bit not already known */
+                tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(op_to_movi(op));
+                tcg_opt_gen_movi(gen_args, args[0], known_one, nb_temps, nb_globals);
+                gen_args += 2;
+                args += 3;
+                break;
+            }
             else
             {
                 reset_temp(args[0], nb_temps, nb_globals);
+                temps[args[0]].known_zero = known_zero;
+                temps[args[0]].known_one = known_one;
                 gen_args[0] = args[0];
                 gen_args[1] = args[1];
                 gen_args[2] = args[2];
@@ -457,9 +955,106 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
                 args += 3;
                 break;
             }
+            CASE_OP_32_64(setcond)
+                : tmp = do_constant_folding_cond(op, args[1], args[2], args[3]);
+            if(tmp != 2) {
+                tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(op_to_movi(op));
+                tcg_opt_gen_movi(gen_args, args[0], tmp, nb_temps, nb_globals);
+                gen_args += 2;
+                args += 4;
+                break;
+            }
+            reset_temp(args[0], nb_temps, nb_globals);
+            temps[args[0]].known_zero = known_zero;
+            temps[args[0]].known_one = known_one;
+            for(i = 0; i < 4; i++) {
+                *gen_args++ = *args++;
+            }
+            break;
+            CASE_OP_32_64(movcond)
+                : tmp = do_constant_folding_cond(op, args[1], args[2], args[5]);
+            if(tmp != 2 || args[3] == args[4]) {
+                tmp = tmp == 0 ? args[4] : args[3];
+                if(temps[tmp].state == TCG_TEMP_CONST) {
+                    tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(op_to_movi(op));
+                    tcg_opt_gen_movi(gen_args, args[0], temps[tmp].val, nb_temps, nb_globals);
+                    gen_args += 2;
+                } else if(args[0] == tmp || (temps[args[0]].state == TCG_TEMP_COPY && temps[args[0]].val == tmp)) {
+                    tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(INDEX_op_nop);
+                } else {
+                    tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(op_to_mov(op));
+                    tcg_opt_gen_mov(s, gen_args, args[0], tmp, nb_temps, nb_globals);
+                    gen_args += 2;
+                }
+                args += 6;
+                break;
+            }
+            reset_temp(args[0], nb_temps, nb_globals);
+            temps[args[0]].known_zero = known_zero;
+            temps[args[0]].known_one = known_one;
+            for(i = 0; i < 6; i++) {
+                *gen_args++ = *args++;
+            }
+            break;
+            CASE_OP_32_64(brcond)
+                : tmp = do_constant_folding_cond(op, args[0], args[1], args[2]);
+            if(tmp == 0) {
+                /* Never taken: fall through into the same basic block. */
+                tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(INDEX_op_nop);
+                args += 4;
+                break;
+            }
+            if(tmp == 1) {
+                /* Always taken: turn it into an unconditional branch. */
+                tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(INDEX_op_br);
+                memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
+                *gen_args++ = args[3];
+                args += 4;
+                break;
+            }
+            memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
+            for(i = 0; i < 4; i++) {
+                *gen_args++ = *args++;
+            }
+            break;
+            CASE_OP_32_64(ld8u)
+                : CASE_OP_32_64(ld8s)
+                : CASE_OP_32_64(ld16u)
+                : CASE_OP_32_64(ld16s)
+                : case INDEX_op_ld_i32:
+            case INDEX_op_ld32u_i64:
+            case INDEX_op_ld32s_i64:
+            case INDEX_op_ld_i64:
+                /* Reuse the value of an identical load from earlier in this
+                   basic block if nothing could have changed it since. */
+                i = lds_find(op, args[1], args[2]);
+                if(i >= 0) {
+                    tmp = lds[i].val;
+                    if(tmp == args[0]) {
+                        tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(INDEX_op_nop);
+                    } else {
+                        lds_forget_temp(args[0]);
+                        tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(op_to_mov(op));
+                        tcg_opt_gen_mov(s, gen_args, args[0], tmp, nb_temps, nb_globals);
+                        gen_args += 2;
+                    }
+                    args += 3;
+                    break;
+                }
+                lds_forget_temp(args[0]);
+                reset_temp(args[0], nb_temps, nb_globals);
+                temps[args[0]].known_zero = known_zero;
+                temps[args[0]].known_one = known_one;
+                if(args[0] != args[1]) {
+                    lds_record(op, args[1], args[2], args[0]);
+                }
+                for(i = 0; i < 3; i++) {
+                    *gen_args++ = *args++;
+                }
+                break;
             case INDEX_op_call:
                 nb_call_args = (args[0] >> 16) + (args[0] & 0xffff);
-                if(!(args[nb_call_args + 1] & (TCG_CALL_CONST | TCG_CALL_PURE))) {
+                if(!(args[nb_call_args + 1] & (TCG_CALL_NO_READ_GLOBALS | TCG_CALL_NO_WRITE_GLOBALS | TCG_CALL_NO_SIDE_EFFECTS))) {
                     for(i = 0; i < nb_globals; i++) {
                         reset_temp(i, nb_temps, nb_globals);
                     }
@@ -475,11 +1070,22 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
                     i--;
                 }
                 break;
+            case INDEX_op_mb:
+                if(prev_mb != NULL) {
+                    /* Merge into the previous barrier: mb X; mb Y => mb X|Y */
+                    *prev_mb |= args[0];
+                    tcg->gen_opc_buf[op_index] = tcg_create_opcode_entry(INDEX_op_nop);
+                } else {
+                    prev_mb = gen_args;
+                    *gen_args++ = args[0];
+                }
+                args++;
+                break;
             case INDEX_op_set_label:
             case INDEX_op_jmp:
+            case INDEX_op_goto_ptr:
             case INDEX_op_br:
-                CASE_OP_32_64(brcond)
-                    : memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
+                memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
                 for(i = 0; i < def->nb_args; i++) {
                     *gen_args = *args;
                     args++;
@@ -492,6 +1098,10 @@ static TCGArg *tcg_constant_folding(TCGContext *s, TCGOpcodeEntry *tcg_opc_ptr,
                 for(i = 0; i < def->nb_oargs; i++) {
                     reset_temp(args[i], nb_temps, nb_globals);
                 }
+                if(def->nb_oargs == 1) {
+                    temps[args[0]].known_zero = known_zero;
+                    temps[args[0]].known_one = known_one;
+                }
                 for(i = 0; i < def->nb_args; i++) {
                     gen_args[i] = args[i];
                 }
@@ -2867,10 +2867,43 @@ static inline void tcg_gen_goto_tb(int idx)
     tcg_gen_op1i(INDEX_op_goto_tb, idx);
 }
 
+//  Jumps to host code at `ptr`, which must be either a TB's code or `code_gen_epilogue`
+//  Use `gen_lookup_and_goto_ptr` instead
+static inline void tcg_gen_goto_ptr(TCGv_ptr ptr)
+{
+#if TCG_TARGET_REG_BITS == 32
+    tcg_gen_op1_i32(INDEX_op_goto_ptr, TCGV_PTR_TO_NAT(ptr));
+#else
+    tcg_gen_op1_i64(INDEX_op_goto_ptr, TCGV_PTR_TO_NAT(ptr));
+#endif
+}
+
 #define TB_HELPER_FROM_TCG_OP
 #include "../include/tb-helper.h"
 #undef TB_HELPER_FROM_TCG_OP
 
+static inline void tcg_gen_mb(TCGBar mb_type)
+{
+    if(unlikely(tcg_context_are_multiple_cpus_registered())) {
+        tcg_gen_op1i(INDEX_op_mb, mb_type);
+    }
+}
+
+static inline void tcg_gen_req_mo(TCGBar type)
+{
+//  No define means guest architecture gives no memory ordering guarantees.
+//  Otherwise, if guest guarantees are stronger than the target ones, e.g.
+//  i386 simulated on Arm host, memory barrier will be generated for each
+//  memory access in multicore setups.
+#ifdef TCG_GUEST_DEFAULT_MO
+    type &= TCG_GUEST_DEFAULT_MO;
+    type &= ~TCG_TARGET_DEFAULT_MO;
+    if(type) {
+        tcg_gen_mb(type | TCG_BAR_SC);
+    }
+#endif
+}
+
 /* handle guest stores */
 
 static inline void tcg_gen_qemu_st_op_i64_i32(TCGOpcode opc, TCGv_i64 val, TCGv_i32 addr, TCGArg mem_index)
@@ -2912,6 +2945,7 @@ static inline void tcg_gen_st_op_i64(TCGOpcode opc, TCGv_i64 arg, TCGv_i64 addr,
 #if TCG_TARGET_REG_BITS == 32
 static inline void tcg_gen_qemu_ld8u(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_op3i_i32(INDEX_op_qemu_ld8u, ret, addr, mem_index);
 #else
@@ -2922,6 +2956,7 @@ static inline void tcg_gen_qemu_ld8u(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld8s(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_op3i_i32(INDEX_op_qemu_ld8s, ret, addr, mem_index);
 #else
@@ -2932,6 +2967,7 @@ static inline void tcg_gen_qemu_ld8s(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld16u(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_op3i_i32(INDEX_op_qemu_ld16u, ret, addr, mem_index);
 #else
@@ -2942,6 +2978,7 @@ static inline void tcg_gen_qemu_ld16u(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld16s(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_op3i_i32(INDEX_op_qemu_ld16s, ret, addr, mem_index);
 #else
@@ -2952,6 +2989,7 @@ static inline void tcg_gen_qemu_ld16s(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld32u(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_op3i_i32(INDEX_op_qemu_ld32, ret, addr, mem_index);
 #else
@@ -2962,6 +3000,7 @@ static inline void tcg_gen_qemu_ld32u(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld32s(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_op3i_i32(INDEX_op_qemu_ld32, ret, addr, mem_index);
 #else
@@ -2972,6 +3011,7 @@ static inline void tcg_gen_qemu_ld32s(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld64(TCGv_i64 ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_op4i_i32(INDEX_op_qemu_ld64, TCGV_LOW(ret), TCGV_HIGH(ret), addr, mem_index);
 #else
@@ -2981,6 +3021,7 @@ static inline void tcg_gen_qemu_ld64(TCGv_i64 ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_st8(TCGv arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     gen_store_table_lock(cpu, addr);
     tcg_request_block_interrupt_check();
 #if TARGET_LONG_BITS == 32
@@ -2994,6 +3035,7 @@ static inline void tcg_gen_qemu_st8(TCGv arg, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_st16(TCGv arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     gen_store_table_lock(cpu, addr);
     tcg_request_block_interrupt_check();
 #if TARGET_LONG_BITS == 32
@@ -3007,6 +3049,7 @@ static inline void tcg_gen_qemu_st16(TCGv arg, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_st32(TCGv arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     gen_store_table_lock(cpu, addr);
     tcg_request_block_interrupt_check();
 #if TARGET_LONG_BITS == 32
@@ -3020,6 +3063,7 @@ static inline void tcg_gen_qemu_st32(TCGv arg, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_st64(TCGv_i64 arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     gen_store_table_lock(cpu, addr);
     tcg_request_block_interrupt_check();
 #if TARGET_LONG_BITS == 32
@@ -3038,26 +3082,31 @@ static inline void tcg_gen_qemu_st64(TCGv_i64 arg, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld8u(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
     tcg_gen_qemu_ld_op(INDEX_op_qemu_ld8u, ret, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_ld8s(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
     tcg_gen_qemu_ld_op(INDEX_op_qemu_ld8s, ret, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_ld16u(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
     tcg_gen_qemu_ld_op(INDEX_op_qemu_ld16u, ret, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_ld16s(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
     tcg_gen_qemu_ld_op(INDEX_op_qemu_ld16s, ret, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_ld32u(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_qemu_ld_op(INDEX_op_qemu_ld32, ret, addr, mem_index);
 #else
@@ -3067,6 +3116,7 @@ static inline void tcg_gen_qemu_ld32u(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld32s(TCGv ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
 #if TARGET_LONG_BITS == 32
     tcg_gen_qemu_ld_op(INDEX_op_qemu_ld32, ret, addr, mem_index);
 #else
@@ -3076,23 +3126,27 @@ static inline void tcg_gen_qemu_ld32s(TCGv ret, TCGv addr, int mem_index)
 
 static inline void tcg_gen_qemu_ld64(TCGv_i64 ret, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_LD | TCG_MO_ST_LD);
     tcg_gen_qemu_ld_op_i64(INDEX_op_qemu_ld64, ret, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_st8(TCGv arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     tcg_request_block_interrupt_check();
     tcg_gen_qemu_st_op(INDEX_op_qemu_st8, arg, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_st16(TCGv arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     tcg_request_block_interrupt_check();
     tcg_gen_qemu_st_op(INDEX_op_qemu_st16, arg, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_st32(TCGv arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     tcg_request_block_interrupt_check();
     tcg_gen_qemu_st_op(INDEX_op_qemu_st32, arg, addr, mem_index);
 }
@@ -3104,12 +3158,14 @@ static inline void tcg_gen_qemu_st32(TCGv arg, TCGv addr, int mem_index)
  */
 static inline void tcg_gen_qemu_st32_unsafe(TCGv arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     tcg_request_block_interrupt_check();
     tcg_gen_qemu_st_op_unsafe(INDEX_op_qemu_st32, arg, addr, mem_index);
 }
 
 static inline void tcg_gen_qemu_st64(TCGv_i64 arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     tcg_request_block_interrupt_check();
     tcg_gen_qemu_st_op_i64(INDEX_op_qemu_st64, arg, addr, mem_index);
 }
@@ -3121,6 +3177,7 @@ static inline void tcg_gen_qemu_st64(TCGv_i64 arg, TCGv addr, int mem_index)
  */
 static inline void tcg_gen_qemu_st64_unsafe(TCGv_i64 arg, TCGv addr, int mem_index)
 {
+    tcg_gen_req_mo(TCG_MO_LD_ST | TCG_MO_ST_ST);
     tcg_request_block_interrupt_check();
     tcg_gen_qemu_st_op_i64_unsafe(INDEX_op_qemu_st64, arg, addr, mem_index);
 }
@@ -3169,28 +3226,6 @@ static inline unsigned get_alignment_bits(TCGMemOp memop)
     return a;
 }
 
-static inline void tcg_gen_mb(TCGBar mb_type)
-{
-    if(unlikely(tcg_context_are_multiple_cpus_registered())) {
-        tcg_gen_op1i(INDEX_op_mb, mb_type);
-    }
-}
-
-static inline void tcg_gen_req_mo(TCGBar type)
-{
-//  No define means guest architecture gives no memory ordering guarantees.
-//  Otherwise, if guest guarantees are stronger than the target ones, e.g.
-//  i386 simulated on Arm host, memory barrier will be generated for each
-//  memory access in multicore setups.
-#ifdef TCG_GUEST_DEFAULT_MO
-    type &= TCG_GUEST_DEFAULT_MO;
-    type &= ~TCG_TARGET_DEFAULT_MO;
-    if(type) {
-        tcg_gen_mb(type | TCG_BAR_SC);
-    }
-#endif
-}
-
 static inline TCGMemOp tcg_canonicalize_memop(TCGMemOp op, bool is64, bool st)
 {
     unsigned a_bits = get_alignment_bits(op);
@@ -22,9 +22,6 @@ uint64_t tcg_helper_muluh_i64(uint64_t arg1, uint64_t arg2);
 uint64_t tcg_helper_clrsb_i64(uint64_t arg);
 uint64_t tcg_helper_clz_i64(uint64_t arg, uint64_t zero_val);
 
-//  TODO?
-#define TCG_CALL_NO_RWG 0
-
 DEF_HELPER_FLAGS_3(memset, TCG_CALL_NO_RWG, ptr, ptr, s32, i64)
 
 DEF_HELPER_FLAGS_3(gvec_mov, TCG_CALL_NO_RWG, void, ptr, ptr, i32)
@@ -205,6 +202,4 @@ DEF_HELPER_FLAGS_4(gvec_leu64, TCG_CALL_NO_RWG, void, ptr, ptr, ptr, i32)
 
 DEF_HELPER_FLAGS_5(gvec_bitsel, TCG_CALL_NO_RWG, void, ptr, ptr, ptr, ptr, i32)
 
-#undef TCG_CALL_NO_RWG
-
 #include "../include/def-helper.h"
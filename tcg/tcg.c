@@ -1094,9 +1094,9 @@ static void tcg_liveness_analysis(TCGContext *s)
                 args++;
                 call_flags = args[nb_oargs + nb_iargs];
 
-                /* pure functions can be removed if their result is not
-                   used */
-                if(call_flags & TCG_CALL_PURE) {
+                /* functions without side effects can be removed if their
+                   result is not used */
+                if(call_flags & TCG_CALL_NO_SIDE_EFFECTS) {
                     for(i = 0; i < nb_oargs; i++) {
                         arg = args[i];
                         if(!dead_temps[arg]) {
@@ -1117,7 +1117,7 @@ static void tcg_liveness_analysis(TCGContext *s)
                         dead_temps[arg] = 1;
                     }
 
-                    if(!(call_flags & TCG_CALL_CONST)) {
+                    if(!(call_flags & TCG_CALL_NO_READ_GLOBALS)) {
                         /* globals are live (they may be used by the call) */
                         memset(dead_temps, 0, s->nb_globals);
                     }
@@ -1341,6 +1341,40 @@ static void save_globals(TCGContext *s, TCGRegSet allocated_regs)
     }
 }
 
+/* store a temporary to memory but keep its register copy valid, as the
+   following code only reads the canonical location. */
+static void temp_sync(TCGContext *s, int temp, TCGRegSet allocated_regs)
+{
+    TCGTemp *ts;
+
+    ts = &s->temps[temp];
+    if(ts->fixed_reg) {
+        return;
+    }
+    if(ts->val_type == TEMP_VAL_REG) {
+        if(!ts->mem_coherent) {
+            if(!ts->mem_allocated) {
+                temp_allocate_frame(s, temp);
+            }
+            tcg_out_st(s, ts->type, ts->reg, ts->mem_reg, ts->mem_offset);
+            ts->mem_coherent = 1;
+        }
+    } else {
+        temp_save(s, temp, allocated_regs);
+    }
+}
+
+/* store globals to their canonical location for code that may read but
+   does not modify them. */
+static void sync_globals(TCGContext *s, TCGRegSet allocated_regs)
+{
+    int i;
+
+    for(i = 0; i < s->nb_globals; i++) {
+        temp_sync(s, i, allocated_regs);
+    }
+}
+
 /* at the end of a basic block, we assume all temporaries are dead and
    all globals are stored at their canonical location. */
 static void tcg_reg_alloc_bb_end(TCGContext *s, TCGRegSet allocated_regs)
@@ -1770,9 +1804,13 @@ static int tcg_reg_alloc_call(TCGContext *s, const TCGOpDef *def, TCGOpcode opc,
     }
 
     /* store globals and free associated registers (we assume the call
-       can modify any global. */
-    if(!(flags & TCG_CALL_CONST)) {
-        save_globals(s, allocated_regs);
+       can modify any global, unless the helper declares otherwise). */
+    if(!(flags & TCG_CALL_NO_READ_GLOBALS)) {
+        if(flags & TCG_CALL_NO_WRITE_GLOBALS) {
+            sync_globals(s, allocated_regs);
+        } else {
+            save_globals(s, allocated_regs);
+        }
     }
 
     tcg_out_op(s, opc, &func_arg, &const_func_arg);
@@ -398,14 +398,30 @@ typedef int TCGv_vec;
 #define TCG_CALL_TYPE_REGPARM_1 0x0001 /* i386 style regparm call (1 reg) */
 #define TCG_CALL_TYPE_REGPARM_2 0x0002 /* i386 style regparm call (2 regs) */
 #define TCG_CALL_TYPE_REGPARM   0x0003 /* i386 style regparm call (3 regs) */
-/* A pure function only reads its arguments and TCG global variables
-   and cannot raise exceptions. Hence a call to a pure function can be
-   safely suppressed if the return value is not used. */
-#define TCG_CALL_PURE 0x0010
-/* A const function only reads its arguments and does not use TCG
-   global variables. Hence a call to such a function does not
-   save TCG global variables back to their canonical location. */
-#define TCG_CALL_CONST 0x0020
+/* A function without side effects does not write TCG global variables
+   and cannot raise exceptions. Hence a call to it can be safely
+   suppressed if the return value is not used. */
+#define TCG_CALL_NO_SIDE_EFFECTS 0x0010
+/* A function that does not read TCG global variables, neither directly
+   nor through an exception. Hence a call to it does not save TCG global
+   variables back to their canonical location. Implies
+   TCG_CALL_NO_WRITE_GLOBALS. */
+#define TCG_CALL_NO_READ_GLOBALS 0x0020
+/* A function that may read but does not write TCG global variables.
+   Globals are stored back to their canonical location before the call,
+   but the copies held in host registers stay valid after it. */
+#define TCG_CALL_NO_WRITE_GLOBALS 0x0040
+
+/* Shorthands used in the helper declarations */
+#define TCG_CALL_NO_RWG    (TCG_CALL_NO_READ_GLOBALS | TCG_CALL_NO_WRITE_GLOBALS)
+#define TCG_CALL_NO_WG     TCG_CALL_NO_WRITE_GLOBALS
+#define TCG_CALL_NO_SE     TCG_CALL_NO_SIDE_EFFECTS
+#define TCG_CALL_NO_RWG_SE (TCG_CALL_NO_RWG | TCG_CALL_NO_SE)
+#define TCG_CALL_NO_WG_SE  (TCG_CALL_NO_WG | TCG_CALL_NO_SE)
+
+/* Older names of the flags above */
+#define TCG_CALL_PURE  TCG_CALL_NO_SIDE_EFFECTS
+#define TCG_CALL_CONST TCG_CALL_NO_READ_GLOBALS
 
 /* used to align parameters */
 #define TCG_CALL_DUMMY_TCGV MAKE_TCGV_I32(-1)
@@ -533,6 +549,8 @@ struct TCGContext {
     uintptr_t *tb_next;
     uint32_t *tb_next_offset;
     uint32_t *tb_jmp_offset;
+    /* goto_ptr support: epilogue entry that returns 0 to cpu_exec */
+    uint8_t *code_gen_epilogue;
 
     /* liveness analysis */
     uint16_t *op_dead_args; /* for each operation, each bit tells if the